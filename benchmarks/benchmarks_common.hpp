@@ -0,0 +1,403 @@
+// Copyright (c) 2022 Ilia Funtov
+// Distributed under the Boost Software License, Version 1.0. (http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace benchmarks_common
+{
+	template <typename T>
+	inline void do_not_optimize(const T & value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		const volatile T * volatile sink = &value;
+		(void)sink;
+#endif
+	}
+
+	class random_generator // splitmix64, deterministic across platforms
+	{
+	public:
+		explicit random_generator(std::uint64_t seed = 0x5eed) : _state(seed) {}
+
+		std::uint64_t next()
+		{
+			auto z = (_state += 0x9e3779b97f4a7c15ull);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+			return z ^ (z >> 31);
+		}
+
+		double uniform(double min, double max) // [min, max)
+		{
+			return min + (max - min) * static_cast<double>(next() >> 11) / static_cast<double>(1ull << 53);
+		}
+
+	private:
+		std::uint64_t _state;
+	};
+
+	template <typename T>
+	const char * type_name();
+
+	template <> inline const char * type_name<std::int8_t>() { return "int8"; }
+	template <> inline const char * type_name<std::int16_t>() { return "int16"; }
+	template <> inline const char * type_name<std::int32_t>() { return "int32"; }
+	template <> inline const char * type_name<std::int64_t>() { return "int64"; }
+	template <> inline const char * type_name<float>() { return "float"; }
+	template <> inline const char * type_name<double>() { return "double"; }
+	template <> inline const char * type_name<long double>() { return "long double"; }
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	std::string fixed_type_name()
+	{
+		return std::string("fixed<") + type_name<value_t>() + "," + std::to_string(fraction_digits_num) + ">";
+	}
+
+	constexpr std::size_t values_num = 4096;
+
+	template <typename fixed_t>
+	std::vector<fixed_t> generate_values(double min_magnitude, double max_magnitude, std::uint64_t seed)
+	{
+		random_generator generator(seed);
+
+		// narrow storage types cannot hold the requested range, clamp it to representable values
+		const auto limit = static_cast<double>(std::numeric_limits<typename fixed_t::value_type>::max()) / fixed_t::scale_value;
+		max_magnitude = std::min(max_magnitude, limit);
+		min_magnitude = std::min(min_magnitude, max_magnitude / 2);
+
+		std::vector<fixed_t> result;
+		result.reserve(values_num);
+		for (std::size_t i = 0; i < values_num; ++i)
+		{
+			const auto magnitude = generator.uniform(min_magnitude, max_magnitude);
+			result.push_back((generator.next() & 1) ? -magnitude : magnitude);
+		}
+
+		return result;
+	}
+
+	constexpr std::size_t hardware_counters_num = 4;
+	constexpr const char * hardware_counter_names[hardware_counters_num] = { "cycles", "instructions", "branch_misses", "cache_misses" };
+
+	using hardware_counter_values = std::array<double, hardware_counters_num>; // NaN for counters that were not collected
+
+	// user space cpu counters of the calling thread through perf_event_open;
+	// counters the kernel or the hardware does not provide (other platforms, virtual machines, perf_event_paranoid) are skipped
+	class hardware_counters
+	{
+	public:
+		hardware_counters()
+		{
+			_descriptors.fill(-1);
+#if defined(__linux__)
+			const std::uint64_t events[hardware_counters_num] =
+				{ PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES };
+			for (std::size_t i = 0; i < hardware_counters_num; ++i)
+			{
+				perf_event_attr attributes{};
+				attributes.size = sizeof(attributes);
+				attributes.type = PERF_TYPE_HARDWARE;
+				attributes.config = events[i];
+				attributes.disabled = 1;
+				attributes.exclude_kernel = 1;
+				attributes.exclude_hv = 1;
+				attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				_descriptors[i] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+			}
+#endif
+		}
+
+		~hardware_counters()
+		{
+#if defined(__linux__)
+			for (const auto descriptor : _descriptors)
+			{
+				if (descriptor >= 0)
+					close(descriptor);
+			}
+#endif
+		}
+
+		hardware_counters(const hardware_counters &) = delete;
+		hardware_counters & operator = (const hardware_counters &) = delete;
+
+		bool available() const
+		{
+			return std::any_of(_descriptors.begin(), _descriptors.end(), [](int descriptor) { return descriptor >= 0; });
+		}
+
+		void start()
+		{
+#if defined(__linux__)
+			for (const auto descriptor : _descriptors)
+			{
+				if (descriptor < 0)
+					continue;
+				ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+				ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+			}
+#endif
+		}
+
+		hardware_counter_values stop()
+		{
+			hardware_counter_values result;
+			result.fill(std::numeric_limits<double>::quiet_NaN());
+#if defined(__linux__)
+			for (std::size_t i = 0; i < hardware_counters_num; ++i)
+			{
+				if (_descriptors[i] < 0)
+					continue;
+				ioctl(_descriptors[i], PERF_EVENT_IOC_DISABLE, 0);
+
+				std::uint64_t values[3]; // count, time enabled, time running
+				if (read(_descriptors[i], values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)) && values[2] != 0)
+					result[i] = static_cast<double>(values[0]) * static_cast<double>(values[1]) / static_cast<double>(values[2]); // scaled up if multiplexed
+			}
+#endif
+			return result;
+		}
+
+	private:
+		std::array<int, hardware_counters_num> _descriptors;
+	};
+
+	struct benchmark_result
+	{
+		std::string name;
+		const char * unit; // operation or byte
+		double ns_per_unit; // best of repetitions
+		double mean_ns_per_unit;
+		double stddev_ns_per_unit; // over repetitions
+		hardware_counter_values counters_per_unit;
+
+		double units_per_second() const { return 1e9 / ns_per_unit; }
+	};
+
+	class benchmark_runner
+	{
+	public:
+		// calls_per_repetition of zero adapts the number of calls to the duration of func, fixed counts make runs comparable
+		explicit benchmark_runner(std::string filter = std::string(), std::size_t calls_per_repetition = 0) :
+			_filter(std::move(filter)), _calls_per_repetition(calls_per_repetition) {}
+
+		// collects hardware counters in an extra untimed repetition of every benchmark, returns false if none is available
+		bool enable_hardware_counters()
+		{
+			_counters.reset(new hardware_counters());
+			if (!_counters->available())
+				_counters.reset();
+			return _counters != nullptr;
+		}
+
+		// func performs ops_per_call operations per invocation;
+		// the best of several timed repetitions is reported to filter out scheduling noise, their spread is reported as well
+		template <typename func_t>
+		void run(const std::string & name, std::size_t ops_per_call, func_t && func)
+		{
+			if (!_filter.empty() && name.find(_filter) == std::string::npos)
+				return;
+
+			const auto & result = add_result(name, "op", measure_ns_per_call(func), ops_per_call);
+			std::printf("%-64s %10.3f ns/op %14.0f ops/s %6.1f%%", name.c_str(), result.ns_per_unit, result.units_per_second(), relative_stddev(result));
+			print_counters(result);
+		}
+
+		// func processes bytes_per_call bytes of input per invocation, the result is reported in MB/s
+		template <typename func_t>
+		void run_throughput(const std::string & name, std::size_t bytes_per_call, func_t && func)
+		{
+			if (!_filter.empty() && name.find(_filter) == std::string::npos)
+				return;
+
+			const auto & result = add_result(name, "byte", measure_ns_per_call(func), bytes_per_call);
+			std::printf("%-64s %10.1f MB/s %21s %6.1f%%", name.c_str(), result.units_per_second() / 1e6, "", relative_stddev(result));
+			print_counters(result);
+		}
+
+		const std::vector<benchmark_result> & results() const { return _results; }
+
+		const benchmark_result * find(const std::string & name) const // nullptr if the benchmark was filtered out
+		{
+			for (const auto & result : _results)
+			{
+				if (result.name == name)
+					return &result;
+			}
+			return nullptr;
+		}
+
+		void write_csv(std::FILE * file) const
+		{
+			std::fprintf(file, "name,unit,ns_per_unit,units_per_second,mean_ns_per_unit,stddev_ns_per_unit");
+			for (const auto counter_name : hardware_counter_names)
+				std::fprintf(file, ",%s_per_unit", counter_name);
+			std::fprintf(file, "\n");
+
+			for (const auto & result : _results)
+			{
+				std::fprintf(file, "\"%s\",%s,%.6g,%.6g,%.6g,%.6g", escape(result.name, "\"\"").c_str(), result.unit,
+					result.ns_per_unit, result.units_per_second(), result.mean_ns_per_unit, result.stddev_ns_per_unit);
+				for (const auto value : result.counters_per_unit) // empty if not collected
+				{
+					if (std::isnan(value))
+						std::fprintf(file, ",");
+					else
+						std::fprintf(file, ",%.6g", value);
+				}
+				std::fprintf(file, "\n");
+			}
+		}
+
+		void write_json(std::FILE * file) const
+		{
+			std::fprintf(file, "[\n");
+			for (std::size_t i = 0; i < _results.size(); ++i)
+			{
+				const auto & result = _results[i];
+				std::fprintf(file, "  {\"name\": \"%s\", \"unit\": \"%s\", \"ns_per_unit\": %.6g, \"units_per_second\": %.6g, \"mean_ns_per_unit\": %.6g, \"stddev_ns_per_unit\": %.6g",
+					escape(result.name, "\\\"").c_str(), result.unit, result.ns_per_unit, result.units_per_second(), result.mean_ns_per_unit, result.stddev_ns_per_unit);
+				for (std::size_t counter = 0; counter < hardware_counters_num; ++counter) // only collected ones
+				{
+					if (!std::isnan(result.counters_per_unit[counter]))
+						std::fprintf(file, ", \"%s_per_unit\": %.6g", hardware_counter_names[counter], result.counters_per_unit[counter]);
+				}
+				std::fprintf(file, "}%s\n", (i + 1 < _results.size()) ? "," : "");
+			}
+			std::fprintf(file, "]\n");
+		}
+
+	private:
+		struct timing
+		{
+			double best_ns;
+			double mean_ns;
+			double stddev_ns;
+			hardware_counter_values counters;
+		};
+
+		const benchmark_result & add_result(const std::string & name, const char * unit, const timing & call_timing, std::size_t units_per_call)
+		{
+			const auto units = static_cast<double>(units_per_call);
+			auto counters_per_unit = call_timing.counters;
+			for (auto & value : counters_per_unit)
+				value /= units;
+
+			_results.push_back(benchmark_result{ name, unit, call_timing.best_ns / units, call_timing.mean_ns / units, call_timing.stddev_ns / units, counters_per_unit });
+			return _results.back();
+		}
+
+		static void print_counters(const benchmark_result & result) // ends the line of the result
+		{
+			for (std::size_t counter = 0; counter < hardware_counters_num; ++counter)
+			{
+				if (!std::isnan(result.counters_per_unit[counter]))
+					std::printf(" %10.2f %s", result.counters_per_unit[counter], hardware_counter_names[counter]);
+			}
+			std::printf("\n");
+			std::fflush(stdout);
+		}
+
+		static double relative_stddev(const benchmark_result & result) // in percents of the mean
+		{
+			return 100.0 * result.stddev_ns_per_unit / result.mean_ns_per_unit;
+		}
+
+		// quote is the replacement of a double quote: doubled for CSV, escaped by backslash for JSON
+		static std::string escape(const std::string & text, const char * quote)
+		{
+			std::string result;
+			for (const auto symbol : text)
+			{
+				if (symbol == '"')
+					result += quote;
+				else
+					result += symbol;
+			}
+			return result;
+		}
+
+		template <typename func_t>
+		timing measure_ns_per_call(func_t & func) const
+		{
+			using clock_t = std::chrono::steady_clock;
+
+			func(); // warm up caches and branch predictors
+
+			auto calls_per_repetition = std::max<std::size_t>(_calls_per_repetition, 1);
+			while (_calls_per_repetition == 0)
+			{
+				const auto start = clock_t::now();
+				for (std::size_t i = 0; i < calls_per_repetition; ++i)
+					func();
+				const auto elapsed = clock_t::now() - start;
+				if (elapsed >= min_repetition_time || calls_per_repetition >= max_calls_per_repetition)
+					break;
+				calls_per_repetition *= 2;
+			}
+
+			double repetition_ns[repetitions_num];
+			for (auto & elapsed_ns : repetition_ns)
+			{
+				const auto start = clock_t::now();
+				for (std::size_t i = 0; i < calls_per_repetition; ++i)
+					func();
+				elapsed_ns = std::chrono::duration<double, std::nano>(clock_t::now() - start).count() / static_cast<double>(calls_per_repetition);
+			}
+
+			double sum_ns = 0.0;
+			for (const auto elapsed_ns : repetition_ns)
+				sum_ns += elapsed_ns;
+			const auto mean_ns = sum_ns / repetitions_num;
+
+			double squares_sum = 0.0;
+			for (const auto elapsed_ns : repetition_ns)
+				squares_sum += (elapsed_ns - mean_ns) * (elapsed_ns - mean_ns);
+
+			hardware_counter_values counters_per_call;
+			counters_per_call.fill(std::numeric_limits<double>::quiet_NaN());
+			if (_counters)
+			{
+				_counters->start();
+				for (std::size_t i = 0; i < calls_per_repetition; ++i)
+					func();
+				counters_per_call = _counters->stop();
+				for (auto & value : counters_per_call)
+					value /= static_cast<double>(calls_per_repetition);
+			}
+
+			return timing{ *std::min_element(repetition_ns, repetition_ns + repetitions_num), mean_ns, std::sqrt(squares_sum / (repetitions_num - 1)), counters_per_call };
+		}
+
+		static constexpr std::chrono::milliseconds min_repetition_time{ 20 };
+		static constexpr std::size_t max_calls_per_repetition = 1u << 20;
+		static constexpr int repetitions_num = 5;
+
+		std::string _filter;
+		std::size_t _calls_per_repetition;
+		std::unique_ptr<hardware_counters> _counters;
+		std::vector<benchmark_result> _results;
+	};
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2022 Ilia Funtov
+// Distributed under the Boost Software License, Version 1.0. (http://www.boost.org/LICENSE_1_0.txt)
+
+// Hot path kernels run both by the benchmark suite and by the performance check, so that the check measures what the suite reports.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <fixed_point_number.hpp>
+
+#include "benchmarks_common.hpp"
+
+namespace fixed_point_arithmetic
+{
+	using namespace benchmarks_common;
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_mult_div_kernels(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		// |lhs| < |rhs| <= 1 keeps both products and quotients in range of the narrowest storage type
+		const auto lhs = generate_values<fixed_point_t>(0.3, 0.6, 1);
+		const auto rhs = generate_values<fixed_point_t>(0.6, 1.0, 2);
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " operator *", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] * rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator /", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] / rhs[i];
+			do_not_optimize(out.data());
+		});
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_round_div_kernels(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+		using mult_type_t = typename details::next_storage_type<value_t>::type;
+
+		// products of two raw values as operator * divides them, the quotients fit into value_t
+		random_generator generator(7);
+		const auto max_factor = std::sqrt(static_cast<double>(std::numeric_limits<value_t>::max()) * fixed_point_t::scale_value);
+		const auto random_value = [&]() { return static_cast<value_t>(generator.uniform(-max_factor, max_factor)); };
+		std::vector<mult_type_t> wide_values(values_num);
+		std::vector<mult_type_t> wide_out(values_num);
+		for (std::size_t i = 0; i < values_num; ++i)
+			wide_values[i] = static_cast<mult_type_t>(random_value()) * static_cast<mult_type_t>(random_value());
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		// divisor is passed through a volatile variable so that the compiler cannot treat it as a constant
+		volatile value_t runtime_scale_value = fixed_point_t::scale_value;
+		runner.run(type_name + " round_div of product by scale (runtime)", values_num, [&]()
+		{
+			const auto divisor = static_cast<mult_type_t>(runtime_scale_value);
+			for (std::size_t i = 0; i < values_num; ++i)
+				wide_out[i] = default_round_policy::round_div(wide_values[i], divisor);
+			do_not_optimize(wide_out.data());
+		});
+
+		runner.run(type_name + " round_div of product by scale (constant)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				wide_out[i] = default_round_policy::round_div_by_constant<value_t, fixed_point_t::scale_value>(wide_values[i]);
+			do_not_optimize(wide_out.data());
+		});
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_to_string_kernel(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 100000.0, 16);
+		std::vector<std::string> strings(values_num);
+
+		runner.run(fixed_type_name<value_t, fraction_digits_num>() + " to_string", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				strings[i] = to_string(values[i]);
+			do_not_optimize(strings.data());
+		});
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_double_conversion_kernels(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 1000.0, 19);
+		std::vector<double> doubles(values.begin(), values.end());
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " construct from double", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = doubles[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " cast to double", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				doubles[i] = static_cast<double>(values[i]);
+			do_not_optimize(doubles.data());
+		});
+	}
+}
@@ -0,0 +1,1101 @@
+// Copyright (c) 2022 Ilia Funtov
+// Distributed under the Boost Software License, Version 1.0. (http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <fixed_point_number.hpp>
+#include <fixed_point_number_batch.hpp>
+#include <fixed_point_number_instrumentation.hpp>
+
+#include "benchmarks_common.hpp"
+#include "benchmarks_kernels.hpp"
+
+namespace fixed_point_arithmetic
+{
+	using namespace benchmarks_common;
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_mult_div_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		run_mult_div_kernels<value_t, fraction_digits_num>(runner);
+
+		const auto lhs = generate_values<fixed_point_t>(0.3, 0.6, 1);
+		const auto rhs = generate_values<fixed_point_t>(0.6, 1.0, 2);
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " try_mul", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = try_mul(lhs[i], rhs[i]).value_or(0);
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " try_div", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = try_div(lhs[i], rhs[i]).value_or(0);
+			do_not_optimize(out.data());
+		});
+	}
+
+	// operands of fixed<int64, 8> whose raw product needs more than 64 bits
+	void run_wide_mult_div_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<std::int64_t, 8>;
+
+		const auto lhs = generate_values<fixed_point_t>(1000.0, 10000.0, 3);
+		const auto rhs = generate_values<fixed_point_t>(1000.0, 10000.0, 4);
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<std::int64_t, 8>();
+
+		runner.run(type_name + " operator * (wide product)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] * rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator / (wide product)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] / rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		random_generator generator(5);
+		std::vector<std::int64_t> raw_lhs(values_num);
+		std::vector<std::int64_t> raw_rhs(values_num);
+		std::vector<std::int64_t> raw_out(values_num);
+		for (std::size_t i = 0; i < values_num; ++i)
+		{
+			raw_lhs[i] = static_cast<std::int64_t>(generator.uniform(-1e12, 1e12));
+			raw_rhs[i] = static_cast<std::int64_t>(generator.uniform(-1e12, 1e12));
+		}
+
+		const auto run_kernel = [&](const std::string & name, auto wide_value)
+		{
+			using wide_t = decltype(wide_value);
+			runner.run(name, values_num, [&]()
+			{
+				for (std::size_t i = 0; i < values_num; ++i)
+					raw_out[i] = static_cast<std::int64_t>(default_round_policy::round_div(wide_t(raw_lhs[i]) * wide_t(raw_rhs[i]), wide_t(fixed_point_t::scale_value)));
+				do_not_optimize(raw_out.data());
+			});
+		};
+
+#if defined(FIXED_POINT_NUMBER_HAS_INT128)
+		run_kernel("int64 mult_div kernel (native __int128)", details::int128_t());
+#endif
+		run_kernel("int64 mult_div kernel (emulated int128)", details::emulated_int128());
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_scale_division_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 20.0, 6);
+		std::vector<value_t> integers(values_num);
+
+		runner.run(fixed_type_name<value_t, fraction_digits_num>() + " cast to integer", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				integers[i] = static_cast<value_t>(values[i]);
+			do_not_optimize(integers.data());
+		});
+
+		run_round_div_kernels<value_t, fraction_digits_num>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_add_subtract_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto lhs = generate_values<fixed_point_t>(0.1, 0.25, 10);
+		const auto rhs = generate_values<fixed_point_t>(0.1, 0.25, 11);
+		std::vector<fixed_point_t> out(values_num);
+		std::vector<checked_result<fixed_point_t>> checked_out(values_num, fixed_point_status::ok);
+
+		random_generator generator(12);
+		const auto max_integer = std::min(100.0, static_cast<double>(std::numeric_limits<value_t>::max() / fixed_point_t::scale_value));
+		std::vector<int> integers(values_num);
+		for (auto & integer : integers)
+			integer = static_cast<int>(generator.uniform(-max_integer, max_integer));
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " operator +", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] + rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator -", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] - rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " try_add", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				checked_out[i] = try_add(lhs[i], rhs[i]);
+			do_not_optimize(checked_out.data());
+		});
+
+		runner.run(type_name + " try_sub", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				checked_out[i] = try_sub(lhs[i], rhs[i]);
+			do_not_optimize(checked_out.data());
+		});
+
+		runner.run(type_name + " operator ++", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+			{
+				auto value = lhs[i];
+				out[i] = ++value;
+			}
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator --", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+			{
+				auto value = lhs[i];
+				out[i] = --value;
+			}
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " unary minus", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = -lhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator ==", values_num, [&]()
+		{
+			std::size_t equal_num = 0;
+			for (std::size_t i = 0; i < values_num; ++i)
+				equal_num += (lhs[i] == rhs[i]);
+			do_not_optimize(equal_num);
+		});
+
+		runner.run(type_name + " operator <", values_num, [&]()
+		{
+			std::size_t less_num = 0;
+			for (std::size_t i = 0; i < values_num; ++i)
+				less_num += (lhs[i] < rhs[i]);
+			do_not_optimize(less_num);
+		});
+
+		runner.run(type_name + " construct from int", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = integers[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " cast to int", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				integers[i] = static_cast<int>(lhs[i]);
+			do_not_optimize(integers.data());
+		});
+	}
+
+	void run_add_subtract_benchmarks(benchmark_runner & runner)
+	{
+		run_add_subtract_benchmarks<std::int8_t, 2>(runner);
+		run_add_subtract_benchmarks<std::int16_t, 4>(runner);
+		run_add_subtract_benchmarks<std::int32_t, 4>(runner);
+		run_add_subtract_benchmarks<std::int32_t, 8>(runner);
+		run_add_subtract_benchmarks<std::int64_t, 4>(runner);
+		run_add_subtract_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	// to_string implementation before to_chars was introduced, kept as a reference point
+	template <typename value_t, unsigned int fraction_digits_num>
+	std::string legacy_to_string(const fixed_point_number<value_t, fraction_digits_num> & value)
+	{
+		const auto parts = value.get_parts();
+		std::string sign;
+		if (parts.negative) sign += '-';
+		const auto fractional = std::to_string(parts.fractional);
+		const auto fract_padding = (fraction_digits_num > fractional.size()) ? std::string(fraction_digits_num - fractional.size(), '0') : std::string();
+		return sign + std::to_string(parts.integer) + '.' + fract_padding + fractional;
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_formatting_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 100000.0, 16);
+		std::vector<std::string> strings(values_num);
+		std::vector<char> buffer(values_num * fixed_point_t::max_chars_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " to_string (legacy)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				strings[i] = legacy_to_string(values[i]);
+			do_not_optimize(strings.data());
+		});
+
+		run_to_string_kernel<value_t, fraction_digits_num>(runner);
+
+		runner.run(type_name + " to_chars", values_num, [&]()
+		{
+			auto position = buffer.data();
+			const auto end = buffer.data() + buffer.size();
+			for (std::size_t i = 0; i < values_num; ++i)
+				position = to_chars(position, end, values[i]).ptr;
+			do_not_optimize(buffer.data());
+		});
+	}
+
+	void run_formatting_benchmarks(benchmark_runner & runner)
+	{
+		run_formatting_benchmarks<std::int8_t, 2>(runner);
+		run_formatting_benchmarks<std::int16_t, 4>(runner);
+		run_formatting_benchmarks<std::int32_t, 4>(runner);
+		run_formatting_benchmarks<std::int32_t, 8>(runner);
+		run_formatting_benchmarks<std::int64_t, 4>(runner);
+		run_formatting_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_parsing_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 100000.0, 17);
+		std::vector<std::string> strings(values_num);
+		for (std::size_t i = 0; i < values_num; ++i)
+			strings[i] = to_string(values[i]);
+
+		std::vector<fixed_point_t> parsed(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " parse (strtod + constructor)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				parsed[i] = std::strtod(strings[i].c_str(), nullptr);
+			do_not_optimize(parsed.data());
+		});
+
+		runner.run(type_name + " from_chars", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+			{
+				const auto & text = strings[i];
+				from_chars(text.data(), text.data() + text.size(), parsed[i]);
+			}
+			do_not_optimize(parsed.data());
+		});
+	}
+
+	void run_parsing_benchmarks(benchmark_runner & runner)
+	{
+		run_parsing_benchmarks<std::int8_t, 2>(runner);
+		run_parsing_benchmarks<std::int16_t, 4>(runner);
+		run_parsing_benchmarks<std::int32_t, 4>(runner);
+		run_parsing_benchmarks<std::int32_t, 8>(runner);
+		run_parsing_benchmarks<std::int64_t, 4>(runner);
+		run_parsing_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_quote_parsing_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		// quote file of "bid,ask" lines with prices of a few typical magnitudes
+		std::string quotes;
+		for (const auto max_price : { 10.0, 1000.0, 100000.0 })
+		{
+			for (auto bid : generate_values<fixed_point_t>(0.0, max_price, 18))
+			{
+				bid = (bid < 0) ? -bid : bid;
+				quotes += to_string(bid) + ',' + to_string(bid + fixed_point_t::from_raw_value(1)) + '\n';
+			}
+		}
+
+		const auto quotes_end = quotes.data() + quotes.size();
+		std::vector<fixed_point_t> prices(2 * 3 * values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run_throughput(type_name + " quote file strtod", quotes.size(), [&]()
+		{
+			auto position = quotes.data();
+			for (auto & price : prices)
+			{
+				char * parsed_end;
+				price = std::strtod(position, &parsed_end);
+				position = parsed_end + 1;
+			}
+			do_not_optimize(prices.data());
+		});
+
+		runner.run_throughput(type_name + " quote file from_chars", quotes.size(), [&]()
+		{
+			const char * position = quotes.data();
+			for (auto & price : prices)
+				position = from_chars(position, quotes_end, price).ptr + 1;
+			do_not_optimize(prices.data());
+		});
+	}
+
+	void run_quote_parsing_benchmarks(benchmark_runner & runner)
+	{
+		run_quote_parsing_benchmarks<std::int64_t, 4>(runner);
+		run_quote_parsing_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_float_conversion_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 1000.0, 19);
+		std::vector<float> floats(values.begin(), values.end());
+		std::vector<long double> long_doubles(values.begin(), values.end());
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " construct from float", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = floats[i];
+			do_not_optimize(out.data());
+		});
+
+		run_double_conversion_kernels<value_t, fraction_digits_num>(runner);
+
+		runner.run(type_name + " construct from long double", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = long_doubles[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " cast to float", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				floats[i] = static_cast<float>(values[i]);
+			do_not_optimize(floats.data());
+		});
+
+		runner.run(type_name + " cast to long double", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				long_doubles[i] = static_cast<long double>(values[i]);
+			do_not_optimize(long_doubles.data());
+		});
+	}
+
+	void run_float_conversion_benchmarks(benchmark_runner & runner)
+	{
+		run_float_conversion_benchmarks<std::int8_t, 2>(runner);
+		run_float_conversion_benchmarks<std::int16_t, 4>(runner);
+		run_float_conversion_benchmarks<std::int32_t, 4>(runner);
+		run_float_conversion_benchmarks<std::int32_t, 8>(runner);
+		run_float_conversion_benchmarks<std::int64_t, 4>(runner);
+		run_float_conversion_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_batch_conversion_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		constexpr std::size_t batch_size = 1u << 20;
+		random_generator generator(20);
+		std::vector<double> doubles(batch_size);
+		for (auto & value : doubles)
+			value = generator.uniform(-1000.0, 1000.0);
+
+		std::vector<fixed_point_t> numbers(batch_size);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " batch of doubles (constructor loop)", batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i)
+				numbers[i] = doubles[i];
+			do_not_optimize(numbers.data());
+		});
+
+		runner.run(type_name + " batch of doubles (convert_batch)", batch_size, [&]()
+		{
+			do_not_optimize(convert_batch(span<const double>(doubles), span<fixed_point_t>(numbers)));
+		});
+
+		runner.run(type_name + " batch to doubles (cast loop)", batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i)
+				doubles[i] = static_cast<double>(numbers[i]);
+			do_not_optimize(doubles.data());
+		});
+
+		runner.run(type_name + " batch to doubles (convert_batch)", batch_size, [&]()
+		{
+			do_not_optimize(convert_batch(span<const fixed_point_t>(numbers), span<double>(doubles)));
+		});
+	}
+
+	void run_batch_conversion_benchmarks(benchmark_runner & runner)
+	{
+		run_batch_conversion_benchmarks<std::int32_t, 4>(runner);
+		run_batch_conversion_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_batch_add_subtract_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		// operands stay in cache, larger batches are limited by memory bandwidth whatever way they are added
+		const auto lhs = generate_values<fixed_point_t>(1.0, 1000.0, 21);
+		const auto rhs = generate_values<fixed_point_t>(1.0, 1000.0, 22);
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " batch add (operator + loop)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] + rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " batch add (add)", values_num, [&]()
+		{
+			do_not_optimize(add(span<const fixed_point_t>(lhs), span<const fixed_point_t>(rhs), span<fixed_point_t>(out)));
+		});
+
+		runner.run(type_name + " batch subtract (operator - loop)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] - rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " batch subtract (sub)", values_num, [&]()
+		{
+			do_not_optimize(sub(span<const fixed_point_t>(lhs), span<const fixed_point_t>(rhs), span<fixed_point_t>(out)));
+		});
+	}
+
+	void run_batch_add_subtract_benchmarks(benchmark_runner & runner)
+	{
+		run_batch_add_subtract_benchmarks<std::int32_t, 4>(runner);
+		run_batch_add_subtract_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_batch_scale_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		constexpr std::size_t batch_size = 10000000;
+		random_generator generator(23);
+		std::vector<fixed_point_t> amounts(batch_size);
+		for (auto & amount : amounts)
+			amount = generator.uniform(-1000.0, 1000.0);
+
+		std::vector<fixed_point_t> out(batch_size);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		// a rate as FX rates usually are and a whole number
+		const fixed_point_t factors[] = { fixed_point_t(1.0875), fixed_point_t(3) };
+		for (const auto & factor : factors)
+		{
+			const auto factor_name = " by " + to_string(factor);
+
+			runner.run(type_name + " batch scale" + factor_name + " (operator * loop)", batch_size, [&]()
+			{
+				for (std::size_t i = 0; i < batch_size; ++i)
+					out[i] = amounts[i] * factor;
+				do_not_optimize(out.data());
+			});
+
+			runner.run(type_name + " batch scale" + factor_name + " (scale_batch)", batch_size, [&]()
+			{
+				do_not_optimize(scale_batch(span<const fixed_point_t>(amounts), factor, span<fixed_point_t>(out)));
+			});
+		}
+	}
+
+	void run_batch_scale_benchmarks(benchmark_runner & runner)
+	{
+		run_batch_scale_benchmarks<std::int32_t, 4>(runner);
+		run_batch_scale_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_batch_divide_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		constexpr std::size_t batch_size = 10000000;
+		random_generator generator(24);
+		std::vector<fixed_point_t> amounts(batch_size);
+		for (auto & amount : amounts)
+			amount = generator.uniform(-1000.0, 1000.0);
+
+		std::vector<fixed_point_t> out(batch_size);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		// e.g. normalizing positions by net asset value
+		const fixed_point_t divisor_value(12.3457);
+		const fixed_point_divisor<fixed_point_t> divisor(divisor_value);
+
+		runner.run(type_name + " batch divide (operator / loop)", batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i)
+				out[i] = amounts[i] / divisor_value;
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " batch divide (try_div by fixed_point_divisor loop)", batch_size, [&]()
+		{
+			for (std::size_t i = 0; i < batch_size; ++i)
+				out[i] = try_div(amounts[i], divisor).value_or(0);
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " batch divide (divide_batch)", batch_size, [&]()
+		{
+			do_not_optimize(divide_batch(span<const fixed_point_t>(amounts), divisor, span<fixed_point_t>(out)));
+		});
+	}
+
+	void run_batch_divide_benchmarks(benchmark_runner & runner)
+	{
+		run_batch_divide_benchmarks<std::int32_t, 4>(runner);
+		run_batch_divide_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_reduction_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		// magnitudes below one keep every partial sum of the naive loops in range of fixed<int32,4>
+		constexpr std::size_t batch_size = 10000000;
+		random_generator generator(25);
+		std::vector<fixed_point_t> a(batch_size);
+		std::vector<fixed_point_t> b(batch_size);
+		for (std::size_t i = 0; i < batch_size; ++i)
+		{
+			a[i] = generator.uniform(-1.0, 1.0);
+			b[i] = generator.uniform(-1.0, 1.0);
+		}
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " sum (operator += loop)", batch_size, [&]()
+		{
+			fixed_point_t total;
+			for (std::size_t i = 0; i < batch_size; ++i)
+				total += a[i];
+			do_not_optimize(total);
+		});
+
+		runner.run(type_name + " sum", batch_size, [&]()
+		{
+			do_not_optimize(sum(span<const fixed_point_t>(a)));
+		});
+
+		runner.run(type_name + " dot (operator * loop)", batch_size, [&]()
+		{
+			fixed_point_t total;
+			for (std::size_t i = 0; i < batch_size; ++i)
+				total += a[i] * b[i];
+			do_not_optimize(total);
+		});
+
+		runner.run(type_name + " dot", batch_size, [&]()
+		{
+			do_not_optimize(dot(span<const fixed_point_t>(a), span<const fixed_point_t>(b)));
+		});
+	}
+
+	void run_reduction_benchmarks(benchmark_runner & runner)
+	{
+		run_reduction_benchmarks<std::int32_t, 4>(runner);
+		run_reduction_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	// the same kernels over hand-written integer ticks, doubles and fixed point numbers,
+	// so that the cost of fixed_point_number can be compared with the alternatives
+	constexpr std::int64_t baseline_scale = 10000; // ticks per unit, matches four fraction digits
+	constexpr std::size_t vwap_window_size = 64; // trades per VWAP, keeps notionals in range of fixed<int32,4>
+	constexpr std::size_t compound_periods_num = 12;
+
+	template <typename number_t>
+	struct baseline_arithmetic;
+
+	template <>
+	struct baseline_arithmetic<std::int64_t> // raw ticks, rounding half away from zero like default_round_policy, no overflow checks
+	{
+		static std::string name() { return "int64 ticks"; }
+		static std::int64_t from_ticks(std::int64_t ticks) { return ticks; }
+
+		static std::int64_t multiply(std::int64_t lhs, std::int64_t rhs)
+		{
+			const auto product = lhs * rhs;
+			return (product + ((product < 0) ? -baseline_scale / 2 : baseline_scale / 2)) / baseline_scale;
+		}
+
+		static std::int64_t divide(std::int64_t lhs, std::int64_t rhs)
+		{
+			const auto dividend = lhs * baseline_scale;
+			auto quotient = dividend / rhs;
+			const auto remainder = dividend % rhs;
+			if (2 * std::abs(remainder) >= std::abs(rhs))
+				quotient += ((dividend < 0) != (rhs < 0)) ? -1 : 1;
+			return quotient;
+		}
+	};
+
+	template <>
+	struct baseline_arithmetic<double>
+	{
+		static std::string name() { return type_name<double>(); }
+		static double from_ticks(std::int64_t ticks) { return static_cast<double>(ticks) / baseline_scale; }
+		static double multiply(double lhs, double rhs) { return lhs * rhs; }
+		static double divide(double lhs, double rhs) { return lhs / rhs; }
+	};
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	struct baseline_arithmetic<fixed_point_number<value_t, fraction_digits_num>>
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		static std::string name() { return fixed_type_name<value_t, fraction_digits_num>(); }
+		static fixed_point_t from_ticks(std::int64_t ticks) { return static_cast<double>(ticks) / baseline_scale; }
+		static fixed_point_t multiply(const fixed_point_t & lhs, const fixed_point_t & rhs) { return lhs * rhs; }
+		static fixed_point_t divide(const fixed_point_t & lhs, const fixed_point_t & rhs) { return lhs / rhs; }
+	};
+
+	struct baseline_data // in ticks, every representation converts the same values
+	{
+		std::vector<std::int64_t> pnl; // small signed amounts, their running sum stays in range of fixed<int32,4>
+		std::vector<std::int64_t> prices;
+		std::vector<std::int64_t> quantities;
+		std::vector<std::int64_t> principals;
+		std::vector<std::int64_t> growth_factors; // one plus interest rate per period
+		std::int64_t scale_factor;
+
+		baseline_data() : pnl(values_num), prices(values_num), quantities(values_num), principals(values_num), growth_factors(values_num), scale_factor(10875)
+		{
+			random_generator generator(26);
+			const auto random_ticks = [&](double min, double max) { return static_cast<std::int64_t>(generator.uniform(min, max) * baseline_scale); };
+			for (std::size_t i = 0; i < values_num; ++i)
+			{
+				pnl[i] = random_ticks(-100.0, 100.0);
+				prices[i] = random_ticks(10.0, 100.0);
+				quantities[i] = random_ticks(1.0, 10.0);
+				principals[i] = random_ticks(100.0, 1000.0);
+				growth_factors[i] = baseline_scale + random_ticks(0.0001, 0.001);
+			}
+		}
+	};
+
+	template <typename number_t>
+	void run_baseline_benchmarks(benchmark_runner & runner, const baseline_data & data)
+	{
+		using arithmetic = baseline_arithmetic<number_t>;
+
+		const auto convert = [](const std::vector<std::int64_t> & ticks)
+		{
+			std::vector<number_t> result;
+			result.reserve(ticks.size());
+			for (const auto value : ticks)
+				result.push_back(arithmetic::from_ticks(value));
+			return result;
+		};
+
+		const auto pnl = convert(data.pnl);
+		const auto prices = convert(data.prices);
+		const auto quantities = convert(data.quantities);
+		const auto principals = convert(data.principals);
+		const auto growth_factors = convert(data.growth_factors);
+		const auto scale_factor = arithmetic::from_ticks(data.scale_factor);
+		std::vector<number_t> out(values_num);
+
+		const auto name = arithmetic::name();
+
+		runner.run(name + " baseline sum", values_num, [&]()
+		{
+			auto total = number_t();
+			for (std::size_t i = 0; i < values_num; ++i)
+				total += pnl[i];
+			do_not_optimize(total);
+		});
+
+		runner.run(name + " baseline scale", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = arithmetic::multiply(prices[i], scale_factor);
+			do_not_optimize(out.data());
+		});
+
+		runner.run(name + " baseline vwap", values_num, [&]()
+		{
+			for (std::size_t window = 0; window < values_num; window += vwap_window_size)
+			{
+				auto notional = number_t();
+				auto volume = number_t();
+				for (std::size_t i = window; i < window + vwap_window_size; ++i)
+				{
+					notional += arithmetic::multiply(prices[i], quantities[i]);
+					volume += quantities[i];
+				}
+				out[window / vwap_window_size] = arithmetic::divide(notional, volume);
+			}
+			do_not_optimize(out.data());
+		});
+
+		runner.run(name + " baseline compound interest", values_num * compound_periods_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+			{
+				auto balance = principals[i];
+				for (std::size_t period = 0; period < compound_periods_num; ++period)
+					balance = arithmetic::multiply(balance, growth_factors[i]);
+				out[i] = balance;
+			}
+			do_not_optimize(out.data());
+		});
+	}
+
+	template <typename number_t>
+	void report_baseline_overhead(const benchmark_runner & runner, const char * kernel)
+	{
+		const auto benchmark_name = [kernel](const std::string & type_name) { return type_name + " baseline " + kernel; };
+		const auto result = runner.find(benchmark_name(baseline_arithmetic<number_t>::name()));
+		const auto ticks_result = runner.find(benchmark_name(baseline_arithmetic<std::int64_t>::name()));
+		const auto double_result = runner.find(benchmark_name(baseline_arithmetic<double>::name()));
+		if (result == nullptr || ticks_result == nullptr || double_result == nullptr)
+			return;
+
+		std::printf("%-64s %9.2fx int64 ticks %9.2fx double\n", (benchmark_name(baseline_arithmetic<number_t>::name()) + " overhead").c_str(),
+			result->ns_per_unit / ticks_result->ns_per_unit, result->ns_per_unit / double_result->ns_per_unit);
+	}
+
+	void run_baseline_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_int32_t = fixed_point_number<std::int32_t, 4>;
+		using fixed_int64_t = fixed_point_number<std::int64_t, 4>;
+
+		const baseline_data data;
+		run_baseline_benchmarks<std::int64_t>(runner, data);
+		run_baseline_benchmarks<double>(runner, data);
+		run_baseline_benchmarks<fixed_int32_t>(runner, data);
+		run_baseline_benchmarks<fixed_int64_t>(runner, data);
+
+		for (const auto kernel : { "sum", "scale", "vwap", "compound interest" })
+		{
+			report_baseline_overhead<fixed_int32_t>(runner, kernel);
+			report_baseline_overhead<fixed_int64_t>(runner, kernel);
+		}
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_constant_benchmarks(benchmark_runner & runner)
+	{
+		using namespace literals;
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 100.0, 15);
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " add constant (double)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = values[i] + fixed_point_t(0.25);
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " add constant (literal)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = values[i] + 0.25_fp;
+			do_not_optimize(out.data());
+		});
+	}
+
+	void run_constant_benchmarks(benchmark_runner & runner)
+	{
+		run_constant_benchmarks<std::int32_t, 4>(runner);
+		run_constant_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_raw_value_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+
+		const auto values = generate_values<fixed_point_t>(1.0, 100.0, 13);
+		std::vector<fixed_point_t> out(values_num);
+
+		random_generator generator(14);
+		std::vector<value_t> raw_values(values_num);
+		for (auto & raw_value : raw_values)
+			raw_value = static_cast<value_t>(generator.uniform(-1e5, 1e5)); // converted raw values must fit into the storage type as integers
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>();
+
+		runner.run(type_name + " vector copy", values_num, [&]()
+		{
+			out = values;
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " load raw values (conversion)", values_num, [&]()
+		{
+			const fixed_point_t scale = fixed_point_t::scale_value;
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = fixed_point_t(raw_values[i]) / scale;
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " load raw values (from_raw_span)", values_num, [&]()
+		{
+			const auto view = from_raw_span<fixed_point_t>(raw_values);
+			std::copy(view.begin(), view.end(), out.begin());
+			do_not_optimize(out.data());
+		});
+	}
+
+	void run_raw_value_benchmarks(benchmark_runner & runner)
+	{
+		run_raw_value_benchmarks<std::int32_t, 4>(runner);
+		run_raw_value_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num, typename overflow_policy_t>
+	void run_overflow_policy_benchmarks(benchmark_runner & runner, const char * policy_name)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, default_round_policy, overflow_policy_t>;
+
+		const auto lhs = generate_values<fixed_point_t>(0.3, 0.6, 8);
+		const auto rhs = generate_values<fixed_point_t>(0.3, 0.6, 9);
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>() + " " + policy_name;
+
+		runner.run(type_name + " operator +", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] + rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator *", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] * rhs[i];
+			do_not_optimize(out.data());
+		});
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_overflow_policy_benchmarks(benchmark_runner & runner)
+	{
+		run_overflow_policy_benchmarks<value_t, fraction_digits_num, throw_overflow_policy>(runner, "throw");
+		run_overflow_policy_benchmarks<value_t, fraction_digits_num, saturate_overflow_policy>(runner, "saturate");
+		run_overflow_policy_benchmarks<value_t, fraction_digits_num, wrap_overflow_policy>(runner, "wrap");
+		run_overflow_policy_benchmarks<value_t, fraction_digits_num, unchecked_overflow_policy>(runner, "unchecked");
+	}
+
+	void run_overflow_policy_benchmarks(benchmark_runner & runner)
+	{
+		run_overflow_policy_benchmarks<std::int32_t, 4>(runner);
+		run_overflow_policy_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num, typename observer_policy_t>
+	void run_observer_policy_benchmarks(benchmark_runner & runner, const char * policy_name)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, default_round_policy, throw_overflow_policy, observer_policy_t>;
+
+		const auto lhs = generate_values<fixed_point_t>(0.3, 0.6, 8);
+		const auto rhs = generate_values<fixed_point_t>(0.3, 0.6, 9);
+		std::vector<fixed_point_t> out(values_num);
+
+		const auto type_name = fixed_type_name<value_t, fraction_digits_num>() + " " + policy_name;
+
+		runner.run(type_name + " operator +", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] + rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator *", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] * rhs[i];
+			do_not_optimize(out.data());
+		});
+
+		runner.run(type_name + " operator /", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+				out[i] = lhs[i] / rhs[i];
+			do_not_optimize(out.data());
+		});
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num>
+	void run_observer_policy_benchmarks(benchmark_runner & runner)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num>;
+		using mult_type_t = typename details::next_storage_type<value_t>::type;
+
+		// operator * of the default policies written out without observer hooks, the null observer must match it
+		const auto lhs = generate_values<fixed_point_t>(0.3, 0.6, 8);
+		const auto rhs = generate_values<fixed_point_t>(0.3, 0.6, 9);
+		std::vector<fixed_point_t> out(values_num);
+
+		runner.run(fixed_type_name<value_t, fraction_digits_num>() + " no observer operator * (hand-written)", values_num, [&]()
+		{
+			for (std::size_t i = 0; i < values_num; ++i)
+			{
+				const auto product = static_cast<mult_type_t>(static_cast<mult_type_t>(lhs[i].raw_value()) * static_cast<mult_type_t>(rhs[i].raw_value()));
+				const auto rounded = default_round_policy::round_div_by_constant<value_t, fixed_point_t::scale_value>(product);
+				out[i] = fixed_point_t::from_raw_value(throw_overflow_policy::narrow<value_t>(rounded));
+			}
+			do_not_optimize(out.data());
+		});
+
+		run_observer_policy_benchmarks<value_t, fraction_digits_num, null_observer_policy>(runner, "null observer");
+		run_observer_policy_benchmarks<value_t, fraction_digits_num, counting_observer_policy<>>(runner, "counting observer");
+	}
+
+	void run_observer_policy_benchmarks(benchmark_runner & runner)
+	{
+		run_observer_policy_benchmarks<std::int32_t, 4>(runner);
+		run_observer_policy_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	void run_scale_division_benchmarks(benchmark_runner & runner)
+	{
+		run_scale_division_benchmarks<std::int8_t, 2>(runner);
+		run_scale_division_benchmarks<std::int16_t, 4>(runner);
+		run_scale_division_benchmarks<std::int32_t, 4>(runner);
+		run_scale_division_benchmarks<std::int32_t, 8>(runner);
+		run_scale_division_benchmarks<std::int64_t, 4>(runner);
+		run_scale_division_benchmarks<std::int64_t, 8>(runner);
+	}
+
+	void run_mult_div_benchmarks(benchmark_runner & runner)
+	{
+		run_mult_div_benchmarks<std::int8_t, 2>(runner);
+		run_mult_div_benchmarks<std::int16_t, 4>(runner);
+		run_mult_div_benchmarks<std::int32_t, 4>(runner);
+		run_mult_div_benchmarks<std::int32_t, 8>(runner);
+		run_mult_div_benchmarks<std::int64_t, 4>(runner);
+		run_mult_div_benchmarks<std::int64_t, 8>(runner);
+		run_wide_mult_div_benchmarks(runner);
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	using benchmarks_common::benchmark_runner;
+
+	// arguments: optional substring of benchmark names to run, --csv <file> and --json <file> to save the results for tracking,
+	// --counters to collect hardware performance counters per operation
+	std::string filter;
+	const char * csv_path = nullptr;
+	const char * json_path = nullptr;
+	bool counters = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--csv" && i + 1 < argc)
+			csv_path = argv[++i];
+		else if (argument == "--json" && i + 1 < argc)
+			json_path = argv[++i];
+		else if (argument == "--counters")
+			counters = true;
+		else
+			filter = argument;
+	}
+
+	benchmark_runner runner(filter);
+	if (counters && !runner.enable_hardware_counters())
+		std::fprintf(stderr, "Hardware performance counters are not available, only timings are reported.\n");
+
+	fixed_point_arithmetic::run_mult_div_benchmarks(runner);
+	fixed_point_arithmetic::run_add_subtract_benchmarks(runner);
+	fixed_point_arithmetic::run_scale_division_benchmarks(runner);
+	fixed_point_arithmetic::run_overflow_policy_benchmarks(runner);
+	fixed_point_arithmetic::run_observer_policy_benchmarks(runner);
+	fixed_point_arithmetic::run_raw_value_benchmarks(runner);
+	fixed_point_arithmetic::run_constant_benchmarks(runner);
+	fixed_point_arithmetic::run_formatting_benchmarks(runner);
+	fixed_point_arithmetic::run_parsing_benchmarks(runner);
+	fixed_point_arithmetic::run_quote_parsing_benchmarks(runner);
+	fixed_point_arithmetic::run_float_conversion_benchmarks(runner);
+	fixed_point_arithmetic::run_batch_conversion_benchmarks(runner);
+	fixed_point_arithmetic::run_batch_add_subtract_benchmarks(runner);
+	fixed_point_arithmetic::run_batch_scale_benchmarks(runner);
+	fixed_point_arithmetic::run_batch_divide_benchmarks(runner);
+	fixed_point_arithmetic::run_reduction_benchmarks(runner);
+	fixed_point_arithmetic::run_baseline_benchmarks(runner);
+
+	const auto save = [&runner](const char * path, void (benchmark_runner::*write)(std::FILE *) const)
+	{
+		if (path == nullptr)
+			return true;
+
+		const auto file = std::fopen(path, "w");
+		if (file == nullptr)
+		{
+			std::fprintf(stderr, "Cannot open %s for writing.\n", path);
+			return false;
+		}
+
+		(runner.*write)(file);
+		return std::fclose(file) == 0;
+	};
+
+	const auto csv_saved = save(csv_path, &benchmark_runner::write_csv);
+	const auto json_saved = save(json_path, &benchmark_runner::write_json);
+	return (csv_saved && json_saved) ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+// Copyright (c) 2022 Ilia Funtov
+// Distributed under the Boost Software License, Version 1.0. (http://www.boost.org/LICENSE_1_0.txt)
+
+// Short fixed-iteration benchmark of the hot paths compared against a committed baseline.
+// Timings are rescaled by a reference kernel measured in the same run, so the baseline recorded on one machine stays usable on another.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fixed_point_number.hpp>
+
+#include "benchmarks_common.hpp"
+#include "benchmarks_kernels.hpp"
+
+namespace fixed_point_arithmetic
+{
+	using namespace benchmarks_common;
+
+	constexpr std::size_t perf_calls_per_repetition = 256;
+	constexpr int perf_attempts_num = 5; // cases slower than the tolerance are measured again to filter out noise
+	const std::string reference_case_name = "reference multiply chain";
+
+	using perf_timings = std::map<std::string, double>; // ns per operation by case name
+
+	// chain of dependent multiplications bound by instruction latency only, it cannot be vectorized and tracks the clock rate
+	void run_reference_check(benchmark_runner & runner)
+	{
+		runner.run(reference_case_name, values_num, [&]()
+		{
+			std::uint64_t value = 1;
+			for (std::size_t i = 0; i < values_num; ++i)
+				value = value * 0x9e3779b97f4a7c15ull + i;
+			do_not_optimize(value);
+		});
+	}
+
+	perf_timings run_perf_checks()
+	{
+		benchmark_runner runner(std::string(), perf_calls_per_repetition);
+
+		run_reference_check(runner);
+		run_mult_div_kernels<std::int32_t, 4>(runner);
+		run_mult_div_kernels<std::int64_t, 8>(runner);
+		run_round_div_kernels<std::int32_t, 4>(runner);
+		run_round_div_kernels<std::int64_t, 8>(runner);
+		run_to_string_kernel<std::int64_t, 4>(runner);
+		run_double_conversion_kernels<std::int32_t, 4>(runner);
+		run_double_conversion_kernels<std::int64_t, 8>(runner);
+		run_reference_check(runner); // once more, the first run may be slowed down by a CPU leaving idle state
+
+		perf_timings result;
+		for (const auto & benchmark : runner.results())
+		{
+			const auto timing = result.emplace(benchmark.name, benchmark.ns_per_unit).first;
+			timing->second = std::min(timing->second, benchmark.ns_per_unit);
+		}
+		return result;
+	}
+
+	// file format: comment lines starting with '#', then "name",ns_per_op lines
+	bool read_baseline(const std::string & path, perf_timings & baseline)
+	{
+		std::ifstream file(path);
+		if (!file)
+			return false;
+
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+			if (line.empty() || line[0] == '#')
+				continue;
+
+			const auto name_end = line.find("\",", 1);
+			if (line[0] != '"' || name_end == std::string::npos)
+				return false;
+
+			baseline[line.substr(1, name_end - 1)] = std::strtod(line.c_str() + name_end + 2, nullptr);
+		}
+
+		return true;
+	}
+
+	bool write_baseline(const std::string & path, const perf_timings & timings)
+	{
+		const auto file = std::fopen(path.c_str(), "w");
+		if (file == nullptr)
+			return false;
+
+		std::fprintf(file, "# best ns/op of fixed_point_number_perf_check on the machine that recorded it\n");
+		std::fprintf(file, "# regenerate after an intended change: fixed_point_number_perf_check <this file> --update\n");
+		for (const auto & timing : timings)
+			std::fprintf(file, "\"%s\",%.4f\n", timing.first.c_str(), timing.second);
+		return std::fclose(file) == 0;
+	}
+
+	struct perf_comparison
+	{
+		double speed_factor; // current reference timing relative to the baseline one
+		std::vector<std::string> regressions;
+		std::vector<std::string> unmatched; // cases present only in the baseline or only in the current run
+	};
+
+	perf_comparison compare(const perf_timings & baseline, const perf_timings & current, double tolerance)
+	{
+		perf_comparison result{ current.at(reference_case_name) / baseline.at(reference_case_name), {}, {} };
+
+		for (const auto & timing : current)
+		{
+			const auto baseline_timing = baseline.find(timing.first);
+			if (baseline_timing == baseline.end())
+				result.unmatched.push_back(timing.first);
+			else if (timing.second > baseline_timing->second * result.speed_factor * (1.0 + tolerance))
+				result.regressions.push_back(timing.first);
+		}
+
+		for (const auto & timing : baseline)
+		{
+			if (current.find(timing.first) == current.end())
+				result.unmatched.push_back(timing.first);
+		}
+
+		return result;
+	}
+
+	void print_comparison(const perf_timings & baseline, const perf_timings & current, const perf_comparison & comparison, double tolerance)
+	{
+		std::printf("\nmachine speed factor %.3f (reference case), tolerance %.0f%%\n", comparison.speed_factor, 100.0 * tolerance);
+		std::printf("%-56s %12s %12s %9s\n", "case", "expected ns", "current ns", "change");
+
+		for (const auto & timing : current)
+		{
+			const auto baseline_timing = baseline.find(timing.first);
+			if (baseline_timing == baseline.end())
+				continue;
+
+			const auto expected = baseline_timing->second * comparison.speed_factor;
+			const auto regressed = std::find(comparison.regressions.begin(), comparison.regressions.end(), timing.first) != comparison.regressions.end();
+			std::printf("%-56s %12.3f %12.3f %+8.1f%%%s\n", timing.first.c_str(), expected, timing.second,
+				100.0 * (timing.second / expected - 1.0), regressed ? "  REGRESSION" : "");
+		}
+
+		for (const auto & name : comparison.unmatched)
+			std::printf("%-56s present only in the %s\n", name.c_str(), (current.find(name) == current.end()) ? "baseline" : "current run");
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	using namespace fixed_point_arithmetic;
+
+	// arguments: baseline file, optional --tolerance <allowed relative slowdown> and --update to record a new baseline
+	if (argc < 2)
+	{
+		std::fprintf(stderr, "Usage: %s <baseline file> [--tolerance <fraction>] [--update]\n", argv[0]);
+		return 2;
+	}
+
+	const std::string baseline_path = argv[1];
+	double tolerance = 0.25;
+	bool update = false;
+	for (int i = 2; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--tolerance" && i + 1 < argc)
+			tolerance = std::strtod(argv[++i], nullptr);
+		else if (argument == "--update")
+			update = true;
+	}
+
+	perf_timings baseline;
+	if (!update && (!read_baseline(baseline_path, baseline) || baseline.find(reference_case_name) == baseline.end()))
+	{
+		std::fprintf(stderr, "Cannot read baseline %s, record one with --update.\n", baseline_path.c_str());
+		return 2;
+	}
+
+	auto current = run_perf_checks();
+
+	if (update)
+	{
+		if (!write_baseline(baseline_path, current))
+		{
+			std::fprintf(stderr, "Cannot write baseline %s.\n", baseline_path.c_str());
+			return 2;
+		}
+		std::printf("\nbaseline written to %s\n", baseline_path.c_str());
+		return 0;
+	}
+
+	auto comparison = compare(baseline, current, tolerance);
+	for (int attempt = 1; attempt < perf_attempts_num && !comparison.regressions.empty(); ++attempt)
+	{
+		std::printf("\n%zu case(s) slower than tolerance, measuring again\n\n", comparison.regressions.size());
+		for (const auto & timing : run_perf_checks())
+		{
+			auto & best = current[timing.first];
+			best = std::min(best, timing.second);
+		}
+		comparison = compare(baseline, current, tolerance);
+	}
+
+	print_comparison(baseline, current, comparison, tolerance);
+
+	if (!comparison.regressions.empty() || !comparison.unmatched.empty())
+	{
+		std::printf("\nperf check failed: %zu regression(s), %zu case(s) missing from baseline or run\n", comparison.regressions.size(), comparison.unmatched.size());
+		return 1;
+	}
+
+	std::printf("\nperf check passed\n");
+	return 0;
+}
@@ -3,43 +3,440 @@
 
 #pragma once
 
-#include <cfenv>
+#include <charconv>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 
+#if defined(__SIZEOF_INT128__) && !defined(FIXED_POINT_NUMBER_DISABLE_INT128)
+#define FIXED_POINT_NUMBER_HAS_INT128
+#endif
+
+// digits are parsed several at a time by loading them into a word, which relies on little-endian byte order
+#if !defined(FIXED_POINT_NUMBER_DISABLE_SWAR) && \
+	((defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+	(defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64))))
+#define FIXED_POINT_NUMBER_HAS_SWAR
+#endif
+
+#if defined(FIXED_POINT_NUMBER_HAS_SWAR) && defined(__SSE4_1__)
+#define FIXED_POINT_NUMBER_HAS_SSE41
+#include <smmintrin.h>
+#endif
+
 namespace fixed_point_arithmetic
 {
 	namespace details
 	{
-		template <typename value_t>
-		constexpr int calc_max_decimal_digits_num(value_t value)
+		constexpr int count_leading_zeros(std::uint64_t value)
 		{
-			if ((value / 10) == 0)
-				return 1;
-			else
-				return calc_max_decimal_digits_num(value / 10) + 1;
+			int result = 0;
+			for (int shift = 32; shift != 0; shift /= 2)
+			{
+				if ((value >> (64 - shift)) == 0)
+				{
+					value <<= shift;
+					result += shift;
+				}
+			}
+			return result;
+		}
+
+		// full 64 x 64 -> 128 bits product, returns the low word
+		constexpr std::uint64_t multiply_words(std::uint64_t a, std::uint64_t b, std::uint64_t & high)
+		{
+#if defined(FIXED_POINT_NUMBER_HAS_INT128)
+			__extension__ const auto product = static_cast<unsigned __int128>(a) * b;
+			high = static_cast<std::uint64_t>(product >> 64);
+			return static_cast<std::uint64_t>(product);
+#else
+			const auto a_low = a & 0xffffffff;
+			const auto a_high = a >> 32;
+			const auto b_low = b & 0xffffffff;
+			const auto b_high = b >> 32;
+
+			const auto low_low = a_low * b_low;
+			const auto high_low = a_high * b_low;
+			const auto low_high = a_low * b_high;
+			const auto high_high = a_high * b_high;
+
+			const auto cross = (low_low >> 32) + (high_low & 0xffffffff) + low_high;
+			high = (high_low >> 32) + (cross >> 32) + high_high;
+			return (cross << 32) | (low_low & 0xffffffff);
+#endif
+		}
+
+		// divides high:low by divisor when high < divisor (Hacker's Delight, divlu)
+		constexpr std::uint64_t divide_double_word(std::uint64_t high, std::uint64_t low, std::uint64_t divisor, std::uint64_t & remainder)
+		{
+			const std::uint64_t base = std::uint64_t(1) << 32;
+			const auto shift = count_leading_zeros(divisor);
+
+			divisor <<= shift;
+			const auto divisor_high = divisor >> 32;
+			const auto divisor_low = divisor & 0xffffffff;
+
+			const auto numerator_32 = (high << shift) | ((shift == 0) ? 0 : (low >> (64 - shift)));
+			const auto numerator_10 = low << shift;
+			const auto numerator_1 = numerator_10 >> 32;
+			const auto numerator_0 = numerator_10 & 0xffffffff;
+
+			auto quotient_1 = numerator_32 / divisor_high;
+			auto remainder_hat = numerator_32 - quotient_1 * divisor_high;
+			while (quotient_1 >= base || quotient_1 * divisor_low > base * remainder_hat + numerator_1)
+			{
+				--quotient_1;
+				remainder_hat += divisor_high;
+				if (remainder_hat >= base)
+					break;
+			}
+
+			const auto numerator_21 = numerator_32 * base + numerator_1 - quotient_1 * divisor;
+
+			auto quotient_0 = numerator_21 / divisor_high;
+			remainder_hat = numerator_21 - quotient_0 * divisor_high;
+			while (quotient_0 >= base || quotient_0 * divisor_low > base * remainder_hat + numerator_0)
+			{
+				--quotient_0;
+				remainder_hat += divisor_high;
+				if (remainder_hat >= base)
+					break;
+			}
+
+			remainder = (numerator_21 * base + numerator_0 - quotient_0 * divisor) >> shift;
+			return quotient_1 * base + quotient_0;
+		}
+
+		// divides double words by an invariant word using a precomputed reciprocal instead of a division instruction
+		// (N. Moller, T. Granlund, "Improved division by invariant integers", 2011)
+		class invariant_divisor
+		{
+		public:
+			constexpr explicit invariant_divisor(std::uint64_t divisor) :
+				_divisor(divisor),
+				_shift(count_leading_zeros(divisor)),
+				_normalized(divisor << count_leading_zeros(divisor)),
+				_reciprocal(calc_reciprocal(divisor << count_leading_zeros(divisor)))
+			{
+			}
+
+			constexpr std::uint64_t divisor() const { return _divisor; }
+
+			// requires high < divisor, so that the quotient fits into a word
+			constexpr std::uint64_t divide(std::uint64_t high, std::uint64_t low, std::uint64_t & remainder) const
+			{
+				if (_shift != 0)
+				{
+					high = (high << _shift) | (low >> (64 - _shift));
+					low <<= _shift;
+				}
+
+				std::uint64_t quotient_high = 0;
+				auto quotient_low = multiply_words(_reciprocal, high, quotient_high);
+				quotient_low += low;
+				quotient_high += high + 1 + ((quotient_low < low) ? 1 : 0);
+
+				auto word_remainder = low - quotient_high * _normalized;
+				if (word_remainder > quotient_low)
+				{
+					--quotient_high;
+					word_remainder += _normalized;
+				}
+
+				if (word_remainder >= _normalized)
+				{
+					++quotient_high;
+					word_remainder -= _normalized;
+				}
+
+				remainder = word_remainder >> _shift;
+				return quotient_high;
+			}
+
+		private:
+			static constexpr std::uint64_t calc_reciprocal(std::uint64_t normalized_divisor) // (2^128 - 1) / divisor - 2^64
+			{
+				std::uint64_t remainder = 0;
+				return divide_double_word(~normalized_divisor, ~std::uint64_t(0), normalized_divisor, remainder);
+			}
+
+			std::uint64_t _divisor;
+			int _shift;
+			std::uint64_t _normalized;
+			std::uint64_t _reciprocal;
+		};
+
+		// portable two's complement 128-bit signed integer for compilers without __int128,
+		// implements the operations required by the multiply/divide path
+		class emulated_int128
+		{
+		public:
+			constexpr emulated_int128() : _high(0), _low(0) {}
+
+			template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+			constexpr emulated_int128(T value) :
+				_high((value < 0) ? ~std::uint64_t(0) : 0),
+				_low(static_cast<std::uint64_t>(value))
+			{
+			}
+
+			template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+			constexpr explicit operator T () const
+			{
+				return static_cast<T>(_low);
+			}
+
+			constexpr emulated_int128 operator - () const
+			{
+				const auto low = ~_low + 1;
+				return emulated_int128(~_high + (low == 0 ? 1 : 0), low);
+			}
+
+			constexpr emulated_int128 & operator += (const emulated_int128 & x)
+			{
+				const auto low = _low + x._low;
+				_high += x._high + (low < _low ? 1 : 0);
+				_low = low;
+				return *this;
+			}
+
+			constexpr emulated_int128 & operator -= (const emulated_int128 & x)
+			{
+				return *this += -x;
+			}
+
+			constexpr emulated_int128 & operator *= (const emulated_int128 & x)
+			{
+				std::uint64_t high = 0;
+				const auto low = multiply_words(_low, x._low, high);
+				_high = high + _high * x._low + _low * x._high;
+				_low = low;
+				return *this;
+			}
+
+			constexpr emulated_int128 & operator /= (const emulated_int128 & x)
+			{
+				emulated_int128 remainder;
+				return *this = divide(*this, x, remainder);
+			}
+
+			constexpr emulated_int128 & operator %= (const emulated_int128 & x)
+			{
+				const auto value = *this;
+				divide(value, x, *this);
+				return *this;
+			}
+
+			friend constexpr emulated_int128 operator + (emulated_int128 lhs, const emulated_int128 & rhs) { return lhs += rhs; }
+			friend constexpr emulated_int128 operator - (emulated_int128 lhs, const emulated_int128 & rhs) { return lhs -= rhs; }
+			friend constexpr emulated_int128 operator * (emulated_int128 lhs, const emulated_int128 & rhs) { return lhs *= rhs; }
+			friend constexpr emulated_int128 operator / (emulated_int128 lhs, const emulated_int128 & rhs) { return lhs /= rhs; }
+			friend constexpr emulated_int128 operator % (emulated_int128 lhs, const emulated_int128 & rhs) { return lhs %= rhs; }
+
+			friend constexpr bool operator == (const emulated_int128 & lhs, const emulated_int128 & rhs)
+			{
+				return lhs._high == rhs._high && lhs._low == rhs._low;
+			}
+
+			friend constexpr bool operator != (const emulated_int128 & lhs, const emulated_int128 & rhs) { return !(lhs == rhs); }
+
+			friend constexpr bool operator < (const emulated_int128 & lhs, const emulated_int128 & rhs)
+			{
+				const auto lhs_high = static_cast<std::int64_t>(lhs._high);
+				const auto rhs_high = static_cast<std::int64_t>(rhs._high);
+				return (lhs_high != rhs_high) ? lhs_high < rhs_high : lhs._low < rhs._low;
+			}
+
+			friend constexpr bool operator > (const emulated_int128 & lhs, const emulated_int128 & rhs) { return rhs < lhs; }
+			friend constexpr bool operator <= (const emulated_int128 & lhs, const emulated_int128 & rhs) { return !(rhs < lhs); }
+			friend constexpr bool operator >= (const emulated_int128 & lhs, const emulated_int128 & rhs) { return !(lhs < rhs); }
+
+			friend constexpr void to_words(const emulated_int128 & value, std::uint64_t & high, std::uint64_t & low)
+			{
+				high = value._high;
+				low = value._low;
+			}
+
+			friend constexpr void from_words(std::uint64_t high, std::uint64_t low, emulated_int128 & value)
+			{
+				value = emulated_int128(high, low);
+			}
+
+		private:
+			constexpr emulated_int128(std::uint64_t high, std::uint64_t low) : _high(high), _low(low) {}
+
+			constexpr bool is_negative() const { return (_high >> 63) != 0; }
+
+			static constexpr bool unsigned_less(const emulated_int128 & lhs, const emulated_int128 & rhs)
+			{
+				return (lhs._high != rhs._high) ? lhs._high < rhs._high : lhs._low < rhs._low;
+			}
+
+			static constexpr emulated_int128 divide_unsigned(const emulated_int128 & value, const emulated_int128 & divisor, emulated_int128 & remainder)
+			{
+				if (divisor._high == 0)
+				{
+					std::uint64_t low_remainder = 0;
+					const auto quotient_high = value._high / divisor._low;
+					const auto quotient_low = divide_double_word(value._high % divisor._low, value._low, divisor._low, low_remainder);
+					remainder = emulated_int128(0, low_remainder);
+					return emulated_int128(quotient_high, quotient_low);
+				}
+
+				// divisor does not fit into 64 bits, so the quotient does: plain shift-subtract division
+				emulated_int128 quotient;
+				remainder = emulated_int128();
+				for (int bit = 127; bit >= 0; --bit)
+				{
+					const auto value_bit = ((bit >= 64) ? (value._high >> (bit - 64)) : (value._low >> bit)) & 1;
+					remainder = emulated_int128((remainder._high << 1) | (remainder._low >> 63), (remainder._low << 1) | value_bit);
+					if (!unsigned_less(remainder, divisor))
+					{
+						remainder += -divisor;
+						quotient._low |= std::uint64_t(1) << bit;
+					}
+				}
+				return quotient;
+			}
+
+			// truncating signed division, as for built-in integers
+			static constexpr emulated_int128 divide(const emulated_int128 & value, const emulated_int128 & divisor, emulated_int128 & remainder)
+			{
+				const auto value_negative = value.is_negative();
+				const auto divisor_negative = divisor.is_negative();
+
+				auto quotient = divide_unsigned(value_negative ? -value : value, divisor_negative ? -divisor : divisor, remainder);
+
+				if (value_negative)
+					remainder = -remainder;
+
+				return (value_negative != divisor_negative) ? -quotient : quotient;
+			}
+
+			std::uint64_t _high;
+			std::uint64_t _low;
+		};
+
+#if defined(FIXED_POINT_NUMBER_HAS_INT128)
+		__extension__ typedef __int128 int128_t;
+		__extension__ typedef unsigned __int128 uint128_t;
+
+		constexpr void to_words(int128_t value, std::uint64_t & high, std::uint64_t & low)
+		{
+			high = static_cast<std::uint64_t>(static_cast<uint128_t>(value) >> 64);
+			low = static_cast<std::uint64_t>(value);
+		}
+
+		constexpr void from_words(std::uint64_t high, std::uint64_t low, int128_t & value)
+		{
+			value = static_cast<int128_t>((static_cast<uint128_t>(high) << 64) | low);
 		}
+#else
+		using int128_t = emulated_int128;
+#endif
+
+		template <typename T>
+		struct is_integer : std::is_integral<T> {};
+
+		template <>
+		struct is_integer<emulated_int128> : std::true_type {};
+
+#if defined(FIXED_POINT_NUMBER_HAS_INT128)
+		template <>
+		struct is_integer<int128_t> : std::true_type {}; // std::is_integral is false for it in strict ISO mode
+#endif
 
 		template <typename T>
-		T gcd(T a, T b)
+		struct is_double_word_integer : std::false_type {};
+
+		template <>
+		struct is_double_word_integer<emulated_int128> : std::true_type {};
+
+#if defined(FIXED_POINT_NUMBER_HAS_INT128)
+		template <>
+		struct is_double_word_integer<int128_t> : std::true_type {};
+#endif
+
+		template <typename T>
+		constexpr T abs(T value) // std::abs has no overloads for extended integer types
+		{
+			return (value < 0) ? static_cast<T>(-value) : value;
+		}
+
+		template <typename round_policy_t, typename value_t, typename divisor_t, typename = void>
+		struct has_round_div_by_constant : std::false_type {};
+
+		template <typename round_policy_t, typename value_t, typename divisor_t>
+		struct has_round_div_by_constant<round_policy_t, value_t, divisor_t,
+			decltype(void(round_policy_t::template round_div_by_constant<divisor_t, divisor_t(1)>(std::declval<value_t>())))> : std::true_type {};
+
+		template <typename divisor_t, divisor_t divisor>
+		struct constant_invariant_divisor
+		{
+			static constexpr invariant_divisor value{ static_cast<std::uint64_t>(divisor) };
+		};
+
+		// truncating division by a positive constant; compilers replace it by multiplication and shifts for built-in types
+		template <typename divisor_t, divisor_t divisor, typename value_t>
+		constexpr typename std::enable_if<!is_double_word_integer<value_t>::value, value_t>::type divide_by_constant(value_t value, value_t & remainder)
+		{
+			remainder = static_cast<value_t>(value % divisor);
+			return static_cast<value_t>(value / divisor);
+		}
+
+		// double word division is a library call even for constant divisors, use the precomputed reciprocal
+		template <typename divisor_t, divisor_t divisor, typename value_t>
+		constexpr typename std::enable_if<is_double_word_integer<value_t>::value, value_t>::type divide_by_constant(value_t value, value_t & remainder)
 		{
-			while (a != 0)
+			constexpr auto & divider = constant_invariant_divisor<divisor_t, divisor>::value;
+
+			const auto negative = value < 0;
+			std::uint64_t high = 0;
+			std::uint64_t low = 0;
+			to_words(negative ? -value : value, high, low);
+
+			if (high >= divider.divisor()) // quotient does not fit into a word
+			{
+				remainder = value % divisor;
+				return value / divisor;
+			}
+
+			std::uint64_t word_remainder = 0;
+			const auto word_quotient = divider.divide(high, low, word_remainder);
+
+			value_t quotient = 0;
+			from_words(0, word_quotient, quotient);
+			from_words(0, word_remainder, remainder);
+
+			if (negative)
 			{
-				const auto c = a;
-				a = b % a;
-				b = c;
+				remainder = -remainder;
+				return -quotient;
 			}
-			return b;
+
+			return quotient;
+		}
+
+		template <typename value_t>
+		constexpr int calc_max_decimal_digits_num(value_t value)
+		{
+			if ((value / 10) == 0)
+				return 1;
+			else
+				return calc_max_decimal_digits_num(value / 10) + 1;
 		}
 
 		template <typename T>
-		bool is_add_overflow(T a, T b, T result) // check if a + b is out of T range
+		constexpr bool is_add_overflow(T a, T b, T result) // check if a + b is out of T range
 		{
 			if (a > 0 && b > 0)
 				return result < 0;
@@ -50,11 +447,142 @@ namespace fixed_point_arithmetic
 		}
 
 		template <typename T>
-		bool is_subtract_overflow(T a, T b, T result) // check if a - b is out of T range
+		constexpr bool is_subtract_overflow(T a, T b, T result) // check if a - b is out of T range
 		{
 			return is_add_overflow(b, result, a); // result = a - b, then a = b + result
 		}
 
+		// two's complement wrap around instead of signed overflow
+
+		template <typename T>
+		constexpr T wrapping_add(T a, T b)
+		{
+			using unsigned_t = typename std::make_unsigned<T>::type;
+			return static_cast<T>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) + static_cast<unsigned_t>(b)));
+		}
+
+		template <typename T>
+		constexpr T wrapping_subtract(T a, T b)
+		{
+			using unsigned_t = typename std::make_unsigned<T>::type;
+			return static_cast<T>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) - static_cast<unsigned_t>(b)));
+		}
+
+		template <typename T>
+		constexpr T wrapping_negate(T a)
+		{
+			using unsigned_t = typename std::make_unsigned<T>::type;
+			return static_cast<T>(static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(a)));
+		}
+
+		// operations below store the wrapped around result and return true if it differs from the exact one;
+		// compiler intrinsics compile to the operation followed by a single overflow flag check
+
+		template <typename T>
+		constexpr bool add_overflow(T a, T b, T & result)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_add_overflow(a, b, &result);
+#else
+			result = wrapping_add(a, b);
+			return is_add_overflow(a, b, result);
+#endif
+		}
+
+		template <typename T>
+		constexpr bool subtract_overflow(T a, T b, T & result)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_sub_overflow(a, b, &result);
+#else
+			result = wrapping_subtract(a, b);
+			return is_subtract_overflow(a, b, result);
+#endif
+		}
+
+		template <typename T>
+		constexpr bool negate_overflow(T a, T & result)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_sub_overflow(T(0), a, &result);
+#else
+			result = wrapping_negate(a);
+			return a == std::numeric_limits<T>::min();
+#endif
+		}
+
+		template <typename T, typename source_t>
+		constexpr bool scale_overflow(source_t value, T scale, T & result) // value * scale for any integral value type and positive scale
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_mul_overflow(+value, scale, &result); // unary plus promotes bool which is not accepted by the intrinsic
+#else
+			static_assert(std::is_integral<source_t>::value, "scale_overflow is applicable only for integral types.");
+			const bool overflow = std::is_signed<source_t>::value ?
+				(static_cast<std::intmax_t>(value) > static_cast<std::intmax_t>(std::numeric_limits<T>::max() / scale) ||
+					static_cast<std::intmax_t>(value) < static_cast<std::intmax_t>(std::numeric_limits<T>::min() / scale)) :
+				static_cast<std::uintmax_t>(value) > static_cast<std::uintmax_t>(std::numeric_limits<T>::max() / scale);
+			if (!overflow)
+				result = static_cast<T>(static_cast<T>(value) * scale);
+			return overflow;
+#endif
+		}
+
+		template <typename destination_t, typename source_t>
+		constexpr bool is_out_of_range(source_t value)
+		{
+			return value < std::numeric_limits<destination_t>::min() || value > std::numeric_limits<destination_t>::max();
+		}
+
+		// false for NaN, infinity and values no round policy can bring into range of destination_t;
+		// values between a limit and the integer next to it may still be rounded to the limit
+		template <typename destination_t, typename float_t>
+		constexpr bool is_in_rounding_range(float_t value)
+		{
+			return value > static_cast<float_t>(std::numeric_limits<destination_t>::min()) - 1 &&
+				value < static_cast<float_t>(std::numeric_limits<destination_t>::max()) + 1;
+		}
+
+		template <typename float_t, typename value_t>
+		constexpr bool is_exact_in_float(value_t value) // conservative check that integer value converts to float_t without rounding
+		{
+			if constexpr (std::numeric_limits<value_t>::digits <= std::numeric_limits<float_t>::digits)
+			{
+				return true;
+			}
+			else
+			{
+				constexpr auto limit = static_cast<value_t>(value_t(1) << std::numeric_limits<float_t>::digits);
+				return value >= -limit && value <= limit;
+			}
+		}
+
+		inline double next_double_towards(double value, double direction) // adjacent double in direction of sign, value must be finite and non-zero
+		{
+			std::uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			bits = ((direction > 0) == (value > 0)) ? bits + 1 : bits - 1; // magnitude is stored in the low bits
+			std::memcpy(&value, &bits, sizeof(bits));
+			return value;
+		}
+
+		inline double product_error(double a, double b, double product) // exact a * b - product, where product is a * b rounded to double
+		{
+#if defined(FP_FAST_FMA)
+			return std::fma(a, b, -product);
+#else
+			// Dekker's algorithm: operands are split into halves of 26 bits, products of the halves are exact
+			constexpr double splitter = 134217729.0; // 2^27 + 1
+			const auto a_scaled = splitter * a;
+			const auto a_high = a_scaled - (a_scaled - a);
+			const auto a_low = a - a_high;
+			const auto b_scaled = splitter * b;
+			const auto b_high = b_scaled - (b_scaled - b);
+			const auto b_low = b - b_high;
+			return ((a_high * b_high - product) + a_high * b_low + a_low * b_high) + a_low * b_low;
+#endif
+		}
+
 		template <typename T>
 		struct next_storage_type {};
 
@@ -71,10 +599,10 @@ namespace fixed_point_arithmetic
 		struct next_storage_type<int> { using type = long long; };
 
 		template <>
-		struct next_storage_type<long> { using type = long long; };
+		struct next_storage_type<long> { using type = int128_t; };
 
 		template <>
-		struct next_storage_type<long long> { using type = long long; };
+		struct next_storage_type<long long> { using type = int128_t; };
 	}
 
 	template <typename value_t, unsigned int digit_num>
@@ -116,6 +644,42 @@ namespace fixed_point_arithmetic
 		round_policy_error() : std::range_error("Round value is out of range of specified destination type.") {}
 	};
 
+	enum class fixed_point_status
+	{
+		ok,
+		out_of_range, // fixed_point_out_of_range_error is thrown by operators
+		conversion_error, // fixed_point_conversion_error is thrown by conversions
+		division_by_zero // std::invalid_argument is thrown by operators
+	};
+
+	// result of a non-throwing operation: either a value or a status describing the error
+	template <typename value_t>
+	class checked_result
+	{
+	public:
+		using value_type = value_t;
+
+		constexpr checked_result(const value_type & value) : _value(value), _status(fixed_point_status::ok) {}
+		constexpr checked_result(fixed_point_status status) : _value(), _status(status) {}
+
+		constexpr bool has_value() const { return _status == fixed_point_status::ok; }
+		constexpr explicit operator bool () const { return has_value(); }
+
+		constexpr fixed_point_status status() const { return _status; }
+
+		// meaningful only if has_value() is true
+		constexpr const value_type & value() const { return _value; }
+
+		constexpr value_type value_or(const value_type & default_value) const
+		{
+			return has_value() ? _value : default_value;
+		}
+
+	private:
+		value_type _value;
+		fixed_point_status _status;
+	};
+
 	class default_round_policy
 	{
 	public:
@@ -134,9 +698,9 @@ namespace fixed_point_arithmetic
 		}
 
 		template <typename value_t>
-		static value_t round_div(value_t value, value_t divisor)
+		static constexpr value_t round_div(value_t value, value_t divisor)
 		{
-			static_assert(std::is_integral<value_t>::value, "round_div operation is applicable only for integer numbers.");
+			static_assert(details::is_integer<value_t>::value, "round_div operation is applicable only for integer numbers.");
 
 			if (divisor == 0 )
 			{
@@ -146,22 +710,258 @@ namespace fixed_point_arithmetic
 			if (value == 0)
 				return 0;
 
-			const auto abs_divisor = std::abs(divisor);
+			const auto abs_divisor = details::abs(divisor);
 			auto divided_value = value / abs_divisor;
-			const auto remainder = std::abs(value) % abs_divisor;
-			if (remainder * 2 >= abs_divisor)
+			const auto remainder = details::abs(value) % abs_divisor;
+			if (remainder >= abs_divisor - remainder) // remainder * 2 >= abs_divisor without overflow
 			{
 				divided_value += (value < 0) ? -1 : 1;
 			}
 
 			return static_cast<value_t>((divisor < 0) ? -divided_value : divided_value);
 		}
+
+		template <typename divisor_t, divisor_t divisor, typename value_t>
+		static constexpr value_t round_div_by_constant(value_t value)
+		{
+			static_assert(details::is_integer<value_t>::value, "round_div_by_constant operation is applicable only for integer numbers.");
+			static_assert(divisor > 0, "Constant divisor must be positive.");
+
+			value_t remainder = 0;
+			auto divided_value = details::divide_by_constant<divisor_t, divisor>(value, remainder);
+
+			constexpr auto half_divisor = divisor - divisor / 2; // remainder * 2 >= divisor
+			if (remainder >= half_divisor)
+			{
+				divided_value += 1;
+			}
+			else if (remainder <= -half_divisor)
+			{
+				divided_value -= 1;
+			}
+
+			return divided_value;
+		}
+	};
+
+	// overflow policies define the result of arithmetic operations that do not fit into the storage type;
+	// narrow converts the rounded result of multiplication or division from the wider intermediate type
+
+	class throw_overflow_policy
+	{
+	public:
+		template <typename value_t>
+		static constexpr value_t add(value_t value1, value_t value2)
+		{
+			value_t result = 0;
+			if (details::add_overflow(value1, value2, result))
+			{
+				throw fixed_point_out_of_range_error("Result of add operation is out of range.");
+			}
+			return result;
+		}
+
+		template <typename value_t>
+		static constexpr value_t subtract(value_t value1, value_t value2)
+		{
+			value_t result = 0;
+			if (details::subtract_overflow(value1, value2, result))
+			{
+				throw fixed_point_out_of_range_error("Result of subtract operation is out of range.");
+			}
+			return result;
+		}
+
+		template <typename value_t>
+		static constexpr value_t negate(value_t value)
+		{
+			value_t result = 0;
+			if (details::negate_overflow(value, result))
+			{
+				throw fixed_point_out_of_range_error("Result of unary minus operation is out of range.");
+			}
+			return result;
+		}
+
+		template <typename value_t, typename wide_value_t>
+		static constexpr value_t narrow(wide_value_t value)
+		{
+			if (details::is_out_of_range<value_t>(value))
+			{
+				throw fixed_point_out_of_range_error("Result of operation is out of range.");
+			}
+			return static_cast<value_t>(value);
+		}
+	};
+
+	class saturate_overflow_policy // clamps result to the minimum or maximum value of the storage type
+	{
+	public:
+		template <typename value_t>
+		static constexpr value_t add(value_t value1, value_t value2)
+		{
+			value_t result = 0;
+			const bool overflow = details::add_overflow(value1, value2, result);
+			return overflow ? limit<value_t>(value2 < 0) : result;
+		}
+
+		template <typename value_t>
+		static constexpr value_t subtract(value_t value1, value_t value2)
+		{
+			value_t result = 0;
+			const bool overflow = details::subtract_overflow(value1, value2, result);
+			return overflow ? limit<value_t>(value2 > 0) : result;
+		}
+
+		template <typename value_t>
+		static constexpr value_t negate(value_t value)
+		{
+			value_t result = 0;
+			const bool overflow = details::negate_overflow(value, result);
+			return overflow ? std::numeric_limits<value_t>::max() : result;
+		}
+
+		template <typename value_t, typename wide_value_t>
+		static constexpr value_t narrow(wide_value_t value)
+		{
+			if (value < std::numeric_limits<value_t>::min())
+				return std::numeric_limits<value_t>::min();
+			if (value > std::numeric_limits<value_t>::max())
+				return std::numeric_limits<value_t>::max();
+			return static_cast<value_t>(value);
+		}
+
+	private:
+		template <typename value_t>
+		static constexpr value_t limit(bool negative)
+		{
+			return negative ? std::numeric_limits<value_t>::min() : std::numeric_limits<value_t>::max();
+		}
+	};
+
+	class wrap_overflow_policy // two's complement wrap around
+	{
+	public:
+		template <typename value_t>
+		static constexpr value_t add(value_t value1, value_t value2)
+		{
+			return details::wrapping_add(value1, value2);
+		}
+
+		template <typename value_t>
+		static constexpr value_t subtract(value_t value1, value_t value2)
+		{
+			return details::wrapping_subtract(value1, value2);
+		}
+
+		template <typename value_t>
+		static constexpr value_t negate(value_t value)
+		{
+			return details::wrapping_negate(value);
+		}
+
+		template <typename value_t, typename wide_value_t>
+		static constexpr value_t narrow(wide_value_t value)
+		{
+			using unsigned_t = typename std::make_unsigned<value_t>::type;
+			return static_cast<value_t>(static_cast<unsigned_t>(value));
+		}
+	};
+
+	class unchecked_overflow_policy // caller guarantees that results fit, overflow is undefined behaviour
+	{
+	public:
+		template <typename value_t>
+		static constexpr value_t add(value_t value1, value_t value2)
+		{
+			return static_cast<value_t>(value1 + value2);
+		}
+
+		template <typename value_t>
+		static constexpr value_t subtract(value_t value1, value_t value2)
+		{
+			return static_cast<value_t>(value1 - value2);
+		}
+
+		template <typename value_t>
+		static constexpr value_t negate(value_t value)
+		{
+			return static_cast<value_t>(-value);
+		}
+
+		template <typename value_t, typename wide_value_t>
+		static constexpr value_t narrow(wide_value_t value)
+		{
+			return static_cast<value_t>(value);
+		}
+	};
+
+	enum class fixed_point_operation
+	{
+		add, // increment too
+		subtract, // decrement too
+		multiply,
+		divide,
+		negate
+	};
+
+	// observer policies are notified about arithmetic operators and rounding divisions, e.g. to collect statistics;
+	// hooks get raw values only, so that the empty ones of the default policy compile to nothing
+
+	class null_observer_policy
+	{
+	public:
+		template <typename fixed_point_t>
+		static constexpr void on_operation(fixed_point_operation, typename fixed_point_t::value_type) {} // with the raw result
+
+		template <typename fixed_point_t, typename value_t>
+		static constexpr void on_round_div(value_t, value_t, value_t) {} // dividend, divisor and the rounded quotient
+	};
+
+	template <typename T>
+	class span // minimal non-owning view of contiguous elements
+	{
+	public:
+		using element_type = T;
+		using value_type = typename std::remove_cv<T>::type;
+		using size_type = std::size_t;
+		using pointer = T *;
+		using reference = T &;
+		using iterator = T *;
+
+		constexpr span() : _data(nullptr), _size(0) {}
+		constexpr span(pointer data, size_type size) : _data(data), _size(size) {}
+
+		template <typename container_t, typename = typename std::enable_if<
+			std::is_convertible<decltype(std::data(std::declval<container_t &>())), pointer>::value>::type>
+		constexpr span(container_t & container) : _data(std::data(container)), _size(std::size(container)) {}
+
+		constexpr pointer data() const { return _data; }
+		constexpr size_type size() const { return _size; }
+		constexpr bool empty() const { return _size == 0; }
+
+		constexpr reference operator [] (size_type index) const { return _data[index]; }
+
+		constexpr iterator begin() const { return _data; }
+		constexpr iterator end() const { return _data + _size; }
+
+	private:
+		pointer _data;
+		size_type _size;
 	};
 
+	namespace details
+	{
+		template <typename destination_t, typename source_t>
+		struct try_convert_impl;
+	}
+
 	template <
 		typename value_t,
 		unsigned int fraction_digits_num,
-		typename round_policy_t = default_round_policy>
+		typename round_policy_t = default_round_policy,
+		typename overflow_policy_t = throw_overflow_policy,
+		typename observer_policy_t = null_observer_policy>
 	class fixed_point_number
 	{
 	public:
@@ -170,6 +970,8 @@ namespace fixed_point_arithmetic
 
 		using value_type = value_t;
 		using round_policy_type = round_policy_t;
+		using overflow_policy_type = overflow_policy_t;
+		using observer_policy_type = observer_policy_t;
 
 		struct number_parts
 		{
@@ -178,378 +980,918 @@ namespace fixed_point_arithmetic
 			value_type fractional;
 		};
 
-		constexpr static auto scale_value = decimal_scale<value_type, fraction_digits_num>::value;
-		static_assert(scale_value != 0, "Scale value must not be zero.");
+		constexpr static auto scale_value = decimal_scale<value_type, fraction_digits_num>::value;
+		static_assert(scale_value != 0, "Scale value must not be zero.");
+
+		// maximum length of text representation: sign, integer digits, point and fraction digits (at least one)
+		constexpr static std::size_t max_chars_num =
+			1 + (max_decimal_digits_num<value_type>::value - fraction_digits_num) + 1 + ((fraction_digits_num > 0) ? fraction_digits_num : 1);
+
+		constexpr fixed_point_number() : _value() {}
+
+		fixed_point_number(const fixed_point_number & src) = default;
+
+		template <typename source_t, typename = typename std::enable_if<std::is_arithmetic<source_t>::value>::type>
+		constexpr fixed_point_number(const source_t & src) : _value()
+		{
+			throw_if_failed(convert_from_source(src, _value), conversion_from_source_error_message<source_t>());
+		}
+
+		fixed_point_number & operator = (const fixed_point_number & src) = default;
+
+		template <typename destination_type>
+		constexpr explicit operator destination_type () const
+		{
+			destination_type result{};
+			throw_if_failed(convert_to_destination(_value, result), conversion_to_destination_error_message<destination_type>());
+			return result;
+		}
+
+		constexpr number_parts get_parts() const
+		{
+			value_type fractional_part = 0;
+			const auto int_part = details::divide_by_constant<value_type, scale_value>(_value, fractional_part);
+
+			bool negative = _value < 0;
+			return number_parts{ negative , static_cast<value_type>(negative ? -int_part: int_part), static_cast<value_type>(negative ? -fractional_part : fractional_part) };
+		}
+
+		constexpr value_type raw_value() const // number multiplied by scale value
+		{
+			return _value;
+		}
+
+		static constexpr fixed_point_number from_raw_value(value_type value)
+		{
+			fixed_point_number result;
+			result._value = value;
+			return result;
+		}
+
+		constexpr fixed_point_number operator + () const
+		{
+			return *this;
+		}
+
+		constexpr fixed_point_number operator - () const
+		{
+			fixed_point_number result;
+			result._value = overflow_policy_type::negate(_value);
+			result.notify(fixed_point_operation::negate);
+			return result;
+		}
+
+		constexpr fixed_point_number & operator += (const fixed_point_number & x)
+		{
+			_value = overflow_policy_type::add(_value, x._value);
+			notify(fixed_point_operation::add);
+			return *this;
+		}
+
+		constexpr fixed_point_number & operator -= (const fixed_point_number & x)
+		{
+			_value = overflow_policy_type::subtract(_value, x._value);
+			notify(fixed_point_operation::subtract);
+			return *this;
+		}
+
+		constexpr fixed_point_number & operator /= (const fixed_point_number & x)
+		{
+			if (x._value == 0)
+			{
+				throw std::invalid_argument("Divisor cannot be zero.");
+			}
+
+			_value = overflow_policy_type::template narrow<value_type>(mult_div(_value, scale_value, x._value));
+			notify(fixed_point_operation::divide);
+			return *this;
+		}
+
+		constexpr fixed_point_number & operator *= (const fixed_point_number & x)
+		{
+			_value = overflow_policy_type::template narrow<value_type>(mult_div_by_scale(_value, x._value));
+			notify(fixed_point_operation::multiply);
+			return *this;
+		}
+
+		fixed_point_number & operator %= (const fixed_point_number & x) = delete;
+		
+		constexpr fixed_point_number & operator ++ () // prefix increment
+		{
+			_value = overflow_policy_type::add(_value, scale_value);
+			notify(fixed_point_operation::add);
+			return *this;
+		}
+
+		constexpr fixed_point_number operator ++ (int) // postfix increment
+		{
+			const auto prev_value = *this;
+			++(*this);
+			return prev_value;
+		}
+
+		constexpr fixed_point_number & operator -- () // prefix decrement
+		{
+			_value = overflow_policy_type::subtract(_value, scale_value);
+			notify(fixed_point_operation::subtract);
+			return *this;
+		}
+
+		constexpr fixed_point_number operator -- (int) // postfix decrement
+		{
+			const auto prev_value = *this;
+			--(*this);
+			return prev_value;
+		}
+
+		friend constexpr fixed_point_number operator + (fixed_point_number lhs, const fixed_point_number & rhs)
+		{
+			lhs += rhs;
+			return lhs;
+		}
+
+		friend constexpr fixed_point_number operator - (fixed_point_number lhs, const fixed_point_number & rhs)
+		{
+			lhs -= rhs;
+			return lhs;
+		}
+
+		friend constexpr fixed_point_number operator * (fixed_point_number lhs, const fixed_point_number & rhs)
+		{
+			lhs *= rhs;
+			return lhs;
+		}
+
+		friend constexpr fixed_point_number operator / (fixed_point_number lhs, const fixed_point_number & rhs)
+		{
+			lhs /= rhs;
+			return lhs;
+		}
+
+		// non-throwing counterparts of the arithmetic operators, they report overflow regardless of the overflow policy
+
+		friend constexpr checked_result<fixed_point_number> try_add(const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			fixed_point_number result;
+			if (details::add_overflow(lhs._value, rhs._value, result._value))
+				return fixed_point_status::out_of_range;
+
+			return result;
+		}
+
+		friend constexpr checked_result<fixed_point_number> try_sub(const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			fixed_point_number result;
+			if (details::subtract_overflow(lhs._value, rhs._value, result._value))
+				return fixed_point_status::out_of_range;
+
+			return result;
+		}
+
+		friend constexpr checked_result<fixed_point_number> try_mul(const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			fixed_point_number result;
+			return make_result(range_checked_cast(mult_div_by_scale(lhs._value, rhs._value), result._value), result);
+		}
+
+		friend constexpr checked_result<fixed_point_number> try_div(const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			if (rhs._value == 0)
+				return fixed_point_status::division_by_zero;
+
+			fixed_point_number result;
+			return make_result(range_checked_cast(mult_div(lhs._value, scale_value, rhs._value), result._value), result);
+		}
+
+		friend constexpr bool operator == (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			return lhs._value == rhs._value;
+		}
+
+		friend constexpr bool operator != (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			return lhs._value != rhs._value;
+		}
+
+		friend constexpr bool operator < (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			return lhs._value < rhs._value;
+		}
+
+		friend constexpr bool operator > (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			return lhs._value > rhs._value;
+		}
+
+		friend constexpr bool operator <= (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			return lhs._value <= rhs._value;
+		}
+
+		friend constexpr bool operator >= (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		{
+			return lhs._value >= rhs._value;
+		}
+
+		friend void swap(fixed_point_number & lhs, fixed_point_number & rhs)
+		{
+			std::swap(lhs._value, rhs._value);
+		}
+
+	private:
+		template <typename destination_t, typename source_t>
+		friend struct details::try_convert_impl;
+
+		constexpr void notify(fixed_point_operation operation) const
+		{
+			observer_policy_type::template on_operation<fixed_point_number>(operation, _value);
+		}
+
+		static constexpr void throw_if_failed(fixed_point_status status, const char * message)
+		{
+			switch (status)
+			{
+			case fixed_point_status::ok:
+				break;
+			case fixed_point_status::out_of_range:
+				throw fixed_point_out_of_range_error(message);
+			case fixed_point_status::conversion_error:
+				throw fixed_point_conversion_error(message);
+			case fixed_point_status::division_by_zero:
+				throw std::invalid_argument("Divisor cannot be zero.");
+			}
+		}
 
-		fixed_point_number() : _value() {}
+		template <typename T>
+		static constexpr checked_result<T> make_result(fixed_point_status status, const T & value)
+		{
+			if (status != fixed_point_status::ok)
+				return status;
 
-		fixed_point_number(const fixed_point_number & src) : _value(src._value) {}
+			return value;
+		}
 
 		template <typename source_t>
-		fixed_point_number(const source_t & src) : _value(convert_from_source(src)) {}
+		static constexpr const char * conversion_from_source_error_message()
+		{
+			return std::is_integral<source_t>::value ?
+				"Result of conversion from integer number does not fit into the storage type." :
+				"Conversion from floating point number caused overflow.";
+		}
 
-		fixed_point_number & operator = (const fixed_point_number & src)
+		template <typename destination_t>
+		static constexpr const char * conversion_to_destination_error_message()
 		{
-			_value = src._value;
-			return *this;
+			return std::is_integral<destination_t>::value ?
+				"Integral destination type cannot fit value from fixed point number." :
+				"Conversion to floating point number caused underflow.";
 		}
 
-		template <typename destination_type>
-		explicit operator destination_type () const
+		template <typename destination_t, typename source_t>
+		static constexpr fixed_point_status range_checked_cast(source_t src, destination_t & result)
 		{
-			return convert_to_destination<destination_type>(_value);
+			if (details::is_out_of_range<destination_t>(src))
+				return fixed_point_status::out_of_range;
+
+			result = static_cast<destination_t>(src);
+			return fixed_point_status::ok;
 		}
 
-		number_parts get_parts() const
+		template <typename source_t>
+		static constexpr
+		typename std::enable_if<std::is_integral<source_t>::value, fixed_point_status>::type convert_from_source(const source_t & src, value_type & result)
 		{
-			const auto int_part = _value / scale_value;
-			const auto int_part_scaled = int_part * scale_value;
-			const auto fractional_part = (_value > int_part_scaled) ? _value - int_part_scaled : int_part_scaled - _value;
+			if (details::scale_overflow(src, scale_value, result))
+				return fixed_point_status::conversion_error;
 
-			bool negative = _value < 0;
-			return number_parts{ negative , static_cast<value_type>(negative ? -int_part: int_part), static_cast<value_type>(fractional_part) };
+			return fixed_point_status::ok;
 		}
 
-		fixed_point_number operator + () const
+		template <typename destination_t>
+		static constexpr
+		typename std::enable_if<std::is_integral<destination_t>::value, fixed_point_status>::type convert_to_destination(const value_type & value, destination_t & result)
 		{
-			return *this;
+			const auto scaled_value = round_div_by_scale(value);
+			if (scaled_value < std::numeric_limits<destination_t>::min() || scaled_value > std::numeric_limits<destination_t>::max())
+				return fixed_point_status::conversion_error;
+
+			result = static_cast<destination_t>(scaled_value);
+			return fixed_point_status::ok;
 		}
 
-		fixed_point_number operator - () const
+		template <typename source_t>
+		static
+		typename std::enable_if<std::is_floating_point<source_t>::value, fixed_point_status>::type convert_from_source(const source_t & src, value_type & result)
 		{
-			fixed_point_number result;
-			result._value = -_value;
-			
-			if ((result._value > 0 && _value > 0) || (result._value < 0 && _value < 0))
+			if constexpr (std::numeric_limits<source_t>::digits <= std::numeric_limits<double>::digits && details::is_exact_in_float<double>(scale_value))
 			{
-				throw fixed_point_out_of_range_error("Result of unary minus operation is out of range.");
+				constexpr double exact_halves_limit = 4503599627370496.0; // 2^52, integers and halves below it are exact doubles
+
+				const auto source = static_cast<double>(src);
+				auto value = source * static_cast<double>(scale_value);
+				if (value > -exact_halves_limit && value < exact_halves_limit) // false for NaN and infinity too
+				{
+					// rounded product is on the same side of every integer and half as the exact one unless it is equal to it,
+					// in that case it is moved towards the exact product so that any round policy sees the right side;
+					// the integers next to the limits of the storage type are among them
+					const auto twice_value = value * 2;
+					if (static_cast<long long>(twice_value) == twice_value)
+					{
+						const auto error = details::product_error(source, static_cast<double>(scale_value), value);
+						if (error != 0)
+							value = details::next_double_towards(value, error);
+					}
+
+					if (!details::is_in_rounding_range<value_type>(value))
+						return fixed_point_status::conversion_error;
+
+					return round_to_storage(value, result);
+				}
 			}
 
-			return result;
+			const auto value = static_cast<conversion_float_type>(src) * scale_value;
+
+			// infinity of an overflowed product and NaN too are rejected before the round policy could throw
+			if (!details::is_in_rounding_range<value_type>(value))
+				return fixed_point_status::conversion_error;
+
+			return round_to_storage(value, result);
 		}
 
-		fixed_point_number & operator += (const fixed_point_number & x)
+		// value must be in rounding range of the storage type; it is rounded to an integral floating point value,
+		// which is exact next to the limits of every storage type, and only then checked for range
+		template <typename float_t>
+		static fixed_point_status round_to_storage(float_t value, value_type & result)
 		{
-			auto tmp_value = _value;
-			tmp_value += x._value;
+			if (range_checked_cast(round_policy_type::template round<float_t>(value), result) != fixed_point_status::ok)
+				return fixed_point_status::conversion_error;
+
+			return fixed_point_status::ok;
+		}
 
-			if (details::is_add_overflow(_value, x._value, tmp_value))
+		template <typename destination_t>
+		static
+		typename std::enable_if<std::is_floating_point<destination_t>::value, fixed_point_status>::type convert_to_destination(const value_type & value, destination_t & result)
+		{
+			if constexpr (details::is_exact_in_float<destination_t>(scale_value))
 			{
-				throw fixed_point_out_of_range_error("Result of add operation is out of range.");
+				// a single division of exact operands gives the correctly rounded quotient
+				if (details::is_exact_in_float<destination_t>(value))
+				{
+					result = static_cast<destination_t>(value) / static_cast<destination_t>(scale_value);
+					return fixed_point_status::ok;
+				}
 			}
 
-			_value = tmp_value;
-			
-			return *this;
+			// the smallest non-zero magnitude 1 / scale_value is far above the normal range limit of float for every scale,
+			// so the quotient cannot underflow
+			result = static_cast<destination_t>(static_cast<conversion_float_type>(value) / scale_value);
+			return fixed_point_status::ok;
 		}
 
-		fixed_point_number & operator -= (const fixed_point_number & x)
+		// both functions return the rounded result in the wider type, narrowing it is up to the caller
+
+		template <typename T>
+		static constexpr typename details::next_storage_type<T>::type mult_div(T value1, T value2, T divisor) // divisor must not be zero
 		{
-			auto tmp_value = _value;
-			tmp_value -= x._value;
+			// product of two values always fits into the twice wider type, so it is enough to round it once
+			using mult_type_t = typename details::next_storage_type<T>::type;
+			static_assert(sizeof(mult_type_t) > sizeof(T), "Multiplication type must be wider than the storage type.");
 
-			if (details::is_subtract_overflow(_value, x._value, tmp_value))
-			{
-				throw fixed_point_out_of_range_error("Result of subtract operation is out of range.");
-			}
+			if (value1 == 0 || value2 == 0)
+				return 0;
 
-			_value = tmp_value;
+			const auto mult_result = static_cast<mult_type_t>(static_cast<mult_type_t>(value1) * static_cast<mult_type_t>(value2));
+			const auto result = round_policy_type::round_div(mult_result, static_cast<mult_type_t>(divisor));
+			observer_policy_type::template on_round_div<fixed_point_number>(mult_result, static_cast<mult_type_t>(divisor), result);
+			return result;
+		}
 
-			return *this;
+		template <typename T>
+		static constexpr typename details::next_storage_type<T>::type mult_div_by_scale(T value1, T value2)
+		{
+			using mult_type_t = typename details::next_storage_type<T>::type;
+			static_assert(sizeof(mult_type_t) > sizeof(T), "Multiplication type must be wider than the storage type.");
+
+			const auto mult_result = static_cast<mult_type_t>(static_cast<mult_type_t>(value1) * static_cast<mult_type_t>(value2));
+			return round_div_by_scale(mult_result);
 		}
 
-		fixed_point_number & operator /= (const fixed_point_number & x)
+		template <typename T>
+		static constexpr T round_div_by_scale(T value)
 		{
-			_value = mult_div(_value, scale_value, x._value);
-			return *this;
+			const auto result = round_div_by_scale(value, details::has_round_div_by_constant<round_policy_type, T, value_type>());
+			observer_policy_type::template on_round_div<fixed_point_number>(value, static_cast<T>(scale_value), result);
+			return result;
 		}
 
-		fixed_point_number & operator *= (const fixed_point_number & x)
+		template <typename T>
+		static constexpr T round_div_by_scale(T value, std::true_type)
 		{
-			_value = mult_div(_value, x._value, scale_value);
-			return *this;
+			return round_policy_type::template round_div_by_constant<value_type, scale_value>(value);
 		}
 
-		fixed_point_number & operator %= (const fixed_point_number & x) = delete;
-		
-		fixed_point_number & operator ++ () // prefix increment
+		template <typename T>
+		static constexpr T round_div_by_scale(T value, std::false_type) // custom round policy without constant divisor support
 		{
-			auto tmp_value = _value;
-			tmp_value += scale_value;
+			return round_policy_type::round_div(value, static_cast<T>(scale_value));
+		}
 
-			if (details::is_add_overflow(_value, scale_value, tmp_value))
-			{
-				throw fixed_point_out_of_range_error("Result of increment operation is out of range.");
-			}
+		using conversion_float_type = long double;
+
+		value_type _value;
+	};
+
+	namespace details
+	{
+		template <typename T>
+		struct is_fixed_point_number : std::false_type {};
 
-			_value = tmp_value;
+		template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+		struct is_fixed_point_number<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> : std::true_type {};
 
-			return *this;
-		}
+		template <typename source_t, typename destination_t>
+		struct copy_const { using type = destination_t; };
+
+		template <typename source_t, typename destination_t>
+		struct copy_const<const source_t, destination_t> { using type = const destination_t; };
 
-		fixed_point_number operator ++ (int) // postfix increment
+		template <typename fixed_point_t, typename raw_t>
+		void check_raw_layout()
 		{
-			const auto prev_value = *this;
-			++(*this);
-			return prev_value;
+			static_assert(is_fixed_point_number<typename std::remove_const<fixed_point_t>::type>::value, "Elements must be fixed point numbers.");
+			static_assert(std::is_same<typename std::remove_const<fixed_point_t>::type::value_type, typename std::remove_const<raw_t>::type>::value,
+				"Raw elements must be of the storage type of fixed point number.");
+			static_assert(sizeof(fixed_point_t) == sizeof(raw_t), "Fixed point number must have the same size as its storage type.");
+			static_assert(alignof(fixed_point_t) == alignof(raw_t), "Fixed point number must have the same alignment as its storage type.");
+			static_assert(std::is_standard_layout<fixed_point_t>::value, "Fixed point number must be a standard layout type.");
+			static_assert(std::is_trivially_copyable<fixed_point_t>::value, "Fixed point number must be trivially copyable.");
 		}
 
-		fixed_point_number & operator -- () // prefix decrement
+		template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t, typename source_t>
+		struct try_convert_impl<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>, source_t>
 		{
-			auto tmp_value = _value;
-			tmp_value -= scale_value;
+			using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
 
-			if (details::is_subtract_overflow(_value, scale_value, tmp_value))
+			static constexpr checked_result<fixed_point_t> convert(const source_t & src)
 			{
-				throw fixed_point_out_of_range_error("Result of decrement operation is out of range.");
+				fixed_point_t result;
+				return fixed_point_t::make_result(fixed_point_t::convert_from_source(src, result._value), result);
 			}
+		};
 
-			_value = tmp_value;
+		template <typename destination_t, typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+		struct try_convert_impl<destination_t, fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>>
+		{
+			using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
 
-			return *this;
-		}
+			static constexpr checked_result<destination_t> convert(const fixed_point_t & src)
+			{
+				destination_t result{};
+				return fixed_point_t::make_result(fixed_point_t::convert_to_destination(src._value, result), result);
+			}
+		};
+	}
+
+	// non-throwing conversion between fixed point number and integral or floating point type, in either direction
+	template <typename destination_t, typename source_t>
+	constexpr checked_result<destination_t> try_convert(const source_t & src)
+	{
+		return details::try_convert_impl<destination_t, source_t>::convert(src);
+	}
 
-		fixed_point_number operator -- (int) // postfix decrement
+	namespace details
+	{
+		enum class decimal_literal_error
 		{
-			const auto prev_value = *this;
-			--(*this);
-			return prev_value;
-		}
+			none,
+			invalid_character,
+			too_many_fraction_digits,
+			out_of_range
+		};
 
-		friend fixed_point_number operator + (fixed_point_number lhs, const fixed_point_number & rhs)
+		template <typename value_t>
+		struct parsed_decimal_literal
 		{
-			lhs += rhs;
-			return lhs;
-		}
+			value_t value;
+			decimal_literal_error error;
+		};
 
-		friend fixed_point_number operator - (fixed_point_number lhs, const fixed_point_number & rhs)
+		template <typename value_t>
+		constexpr bool append_decimal_digit(value_t & value, value_t digit, bool negative) // value * 10 +/- digit, returns true on overflow
 		{
-			lhs -= rhs;
-			return lhs;
+			// the value is accumulated with its sign so that the minimum value can be reached too
+			return scale_overflow(value, value_t(10), value) ||
+				(negative ? subtract_overflow(value, digit, value) : add_overflow(value, digit, value));
 		}
 
-		friend fixed_point_number operator * (fixed_point_number lhs, const fixed_point_number & rhs)
+#if defined(FIXED_POINT_NUMBER_HAS_SWAR)
+		inline std::uint64_t load_eight_chars(const char * chars)
 		{
-			lhs *= rhs;
-			return lhs;
+			std::uint64_t word;
+			std::memcpy(&word, chars, sizeof(word));
+			return word; // first char is in the lowest byte
 		}
 
-		friend fixed_point_number operator / (fixed_point_number lhs, const fixed_point_number & rhs)
+		constexpr bool is_eight_digits(std::uint64_t word)
 		{
-			lhs /= rhs;
-			return lhs;
+			// digit bytes are 0x30..0x39, adding 6 keeps their high nibble 3 while any other byte gets another one
+			return ((word & 0xF0F0F0F0F0F0F0F0ull) | (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
 		}
 
-		friend bool operator == (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		constexpr std::uint32_t parse_eight_digits(std::uint64_t word)
 		{
-			return lhs._value == rhs._value;
+			word -= 0x3030303030303030ull;
+			word = word * 10 + (word >> 8); // 2-digit numbers in every other byte
+			word = ((word & 0x000000FF000000FFull) * (100 + (1000000ull << 32)) +
+				((word >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32))) >> 32;
+			return static_cast<std::uint32_t>(word);
 		}
+#endif
 
-		friend bool operator != (const fixed_point_number & lhs, const fixed_point_number & rhs)
+#if defined(FIXED_POINT_NUMBER_HAS_SSE41)
+		inline bool parse_sixteen_digits(const char * chars, std::uint64_t & result)
 		{
-			return lhs._value != rhs._value;
+			const auto nine = _mm_set1_epi8(9);
+			const auto digits = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(chars)), _mm_set1_epi8('0'));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(digits, nine), nine)) != 0xFFFF)
+				return false;
+
+			const auto pairs = _mm_maddubs_epi16(digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+			const auto quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+			const auto octets = _mm_madd_epi16(_mm_packus_epi32(quads, quads), _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+			result = static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(octets))) * 100000000u +
+				static_cast<std::uint32_t>(_mm_extract_epi32(octets, 1));
+			return true;
 		}
+#endif
 
-		friend bool operator < (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		// appends a run of at most max_digits_num decimal digits to value, returns the position after the run;
+		// once overflow is set the rest of the run is skipped over without touching value
+		template <typename value_t>
+		const char * append_decimal_digits(const char * position, const char * last, std::size_t max_digits_num, bool negative, value_t & value, bool & overflow)
 		{
-			return lhs._value < rhs._value;
+			const auto end = (static_cast<std::size_t>(last - position) > max_digits_num) ? position + max_digits_num : last;
+
+#if defined(FIXED_POINT_NUMBER_HAS_SWAR)
+			if constexpr (std::numeric_limits<value_t>::digits >= 63)
+			{
+				// chunks are taken only while they cannot overflow, the digit by digit loop below detects overflow exactly
+#if defined(FIXED_POINT_NUMBER_HAS_SSE41)
+				constexpr value_t chunk16_scale = 10000000000000000;
+				constexpr value_t chunk16_limit = (std::numeric_limits<value_t>::max() - (chunk16_scale - 1)) / chunk16_scale;
+
+				std::uint64_t chunk16 = 0;
+				while (!overflow && end - position >= 16 && value <= chunk16_limit && value >= -chunk16_limit &&
+					parse_sixteen_digits(position, chunk16))
+				{
+					const auto chunk = static_cast<value_t>(chunk16);
+					value = value * chunk16_scale + (negative ? -chunk : chunk);
+					position += 16;
+				}
+#endif
+				constexpr value_t chunk8_scale = 100000000;
+				constexpr value_t chunk8_limit = (std::numeric_limits<value_t>::max() - (chunk8_scale - 1)) / chunk8_scale;
+
+				while (!overflow && end - position >= 8 && value <= chunk8_limit && value >= -chunk8_limit)
+				{
+					const auto word = load_eight_chars(position);
+					if (!is_eight_digits(word))
+						break;
+
+					const auto chunk = static_cast<value_t>(parse_eight_digits(word));
+					value = value * chunk8_scale + (negative ? -chunk : chunk);
+					position += 8;
+				}
+			}
+#endif
+
+			for (; position != end && *position >= '0' && *position <= '9'; ++position)
+				overflow = overflow || append_decimal_digit(value, static_cast<value_t>(*position - '0'), negative);
+
+			return position;
 		}
 
-		friend bool operator > (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		// parses characters of a numeric literal into the raw value of fixed point number with given fraction digits num
+		template <typename value_t, unsigned int fraction_digits_num, bool negative, char... chars>
+		constexpr parsed_decimal_literal<value_t> parse_decimal_literal()
 		{
-			return lhs._value > rhs._value;
+			constexpr char literal[] = { chars... };
+
+			value_t value = 0;
+			unsigned int literal_fraction_digits_num = 0;
+			bool has_point = false;
+
+			for (const auto c : literal)
+			{
+				if (c == '\'') // digit separator
+					continue;
+
+				if (c == '.' && !has_point)
+				{
+					has_point = true;
+					continue;
+				}
+
+				if (c < '0' || c > '9')
+					return { 0, decimal_literal_error::invalid_character };
+
+				const value_t digit = c - '0';
+				if (has_point && ++literal_fraction_digits_num > fraction_digits_num)
+				{
+					if (digit != 0) // trailing zeros do not change the value
+						return { 0, decimal_literal_error::too_many_fraction_digits };
+					continue;
+				}
+
+				if (append_decimal_digit(value, digit, negative))
+					return { 0, decimal_literal_error::out_of_range };
+			}
+
+			for (; literal_fraction_digits_num < fraction_digits_num; ++literal_fraction_digits_num)
+			{
+				if (scale_overflow(value, value_t(10), value))
+					return { 0, decimal_literal_error::out_of_range };
+			}
+
+			return { value, decimal_literal_error::none };
 		}
+	}
 
-		friend bool operator <= (const fixed_point_number & lhs, const fixed_point_number & rhs)
+	// numeric literal converted to fixed point number at compile time, digits are checked against destination type
+	template <bool negative, char... chars>
+	class decimal_literal
+	{
+	public:
+		constexpr decimal_literal<!negative, chars...> operator - () const
 		{
-			return lhs._value <= rhs._value;
+			return {};
 		}
 
-		friend bool operator >= (const fixed_point_number & lhs, const fixed_point_number & rhs)
+		template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+		constexpr operator fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t> () const
 		{
-			return lhs._value >= rhs._value;
+			constexpr auto parsed = details::parse_decimal_literal<value_t, fraction_digits_num, negative, chars...>();
+			static_assert(parsed.error != details::decimal_literal_error::invalid_character, "Only decimal literals without exponent are supported.");
+			static_assert(parsed.error != details::decimal_literal_error::too_many_fraction_digits, "Literal has more fraction digits than fixed point number.");
+			static_assert(parsed.error != details::decimal_literal_error::out_of_range, "Literal is out of range of fixed point number.");
+
+			return fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>::from_raw_value(parsed.value);
 		}
+	};
 
-		friend void swap(fixed_point_number & lhs, fixed_point_number & rhs)
+	namespace literals
+	{
+		template <char... chars>
+		constexpr decimal_literal<false, chars...> operator "" _fp()
 		{
-			std::swap(lhs._value, rhs._value);
+			return {};
 		}
+	}
 
-	private:
-		template <typename destination_t, typename source_t>
-		static
-		destination_t range_checked_cast(source_t src)
+	// zero-copy views of contiguous fixed point numbers as their raw storage values and vice versa,
+	// raw value of a fixed point number is the number multiplied by its scale value
+
+	template <typename container_t>
+	auto as_raw_span(container_t & values)
+	{
+		using fixed_point_t = typename std::remove_pointer<decltype(std::data(values))>::type;
+		using raw_t = typename details::copy_const<fixed_point_t, typename std::remove_const<fixed_point_t>::type::value_type>::type;
+		details::check_raw_layout<fixed_point_t, raw_t>();
+
+		return span<raw_t>(reinterpret_cast<raw_t *>(std::data(values)), std::size(values));
+	}
+
+	template <typename fixed_point_t, typename container_t>
+	auto from_raw_span(container_t & values)
+	{
+		using raw_t = typename std::remove_pointer<decltype(std::data(values))>::type;
+		using result_t = typename details::copy_const<raw_t, fixed_point_t>::type;
+		details::check_raw_layout<result_t, raw_t>();
+
+		return span<result_t>(reinterpret_cast<result_t *>(std::data(values)), std::size(values));
+	}
+
+	namespace details
+	{
+		struct decimal_digit_pairs // "00", "01", ..., "99"
 		{
-			if (src < std::numeric_limits<destination_t>::min() || src > std::numeric_limits<destination_t>::max())
+			char chars[200];
+
+			constexpr decimal_digit_pairs() : chars()
 			{
-				throw fixed_point_out_of_range_error("Result of operation is out of range.");
+				for (int i = 0; i < 100; ++i)
+				{
+					chars[2 * i] = static_cast<char>('0' + i / 10);
+					chars[2 * i + 1] = static_cast<char>('0' + i % 10);
+				}
 			}
+		};
 
-			return static_cast<destination_t>(src);
-		}
+		inline constexpr decimal_digit_pairs digit_pairs{};
 
-		template <typename source_t>
-		static
-		typename std::enable_if<std::is_integral<source_t>::value, value_type>::type convert_from_source(const source_t & src)
+		// writes exactly digits_num lowest decimal digits of value backwards from end, returns the new beginning
+		template <unsigned int digits_num, typename unsigned_t>
+		inline char * write_fixed_digits(char * end, unsigned_t value)
 		{
-			const auto value = src * scale_value;
-			if ((value / scale_value) != src || 
-				value < std::numeric_limits<value_type>::min() || value > std::numeric_limits<value_type>::max())
+			for (unsigned int i = 0; i < digits_num / 2; ++i, value /= 100)
 			{
-				throw fixed_point_conversion_error("Result of conversion from integer number does not fit into the storage type.");
+				end -= 2;
+				std::memcpy(end, digit_pairs.chars + 2 * (value % 100), 2);
 			}
 
-			return static_cast<value_type>(value);
+			if constexpr (digits_num % 2 != 0)
+				*--end = static_cast<char>('0' + value % 10);
+
+			return end;
 		}
 
-		template <typename destination_t>
-		static
-		typename std::enable_if<std::is_integral<destination_t>::value, destination_t>::type convert_to_destination(const value_type & value)
+		// writes all decimal digits of value backwards from end, returns the new beginning
+		template <typename unsigned_t>
+		inline char * write_digits(char * end, unsigned_t value)
 		{
-			const auto scaled_value = round_policy_type::round_div(value, scale_value);
-			if (scaled_value < std::numeric_limits<destination_t>::min() || scaled_value > std::numeric_limits<destination_t>::max())
+			for (; value >= 100; value /= 100)
 			{
-				throw fixed_point_conversion_error("Integral destination type cannot fit value from fixed point number.");
+				end -= 2;
+				std::memcpy(end, digit_pairs.chars + 2 * (value % 100), 2);
 			}
 
-			return static_cast<destination_t>(scaled_value);
-		}
-
-		template <typename source_t>
-		static
-		typename std::enable_if<std::is_floating_point<source_t>::value, value_type>::type convert_from_source(const source_t & src)
-		{
-			std::feclearexcept(FE_OVERFLOW);
-			const auto value = static_cast<conversion_float_type>(src) * scale_value;
-			if (std::fetestexcept(FE_OVERFLOW))
+			if (value >= 10)
 			{
-				throw fixed_point_conversion_error("Conversion from floating point number caused overflow.");
+				end -= 2;
+				std::memcpy(end, digit_pairs.chars + 2 * value, 2);
+			}
+			else
+			{
+				*--end = static_cast<char>('0' + value);
 			}
 
-			return round_policy_type::template round<value_type>(value);
+			return end;
 		}
+	}
 
-		template <typename destination_t>
-		static
-		typename std::enable_if<std::is_floating_point<destination_t>::value, destination_t>::type convert_to_destination(const value_type & value)
-		{
-			std::feclearexcept(FE_UNDERFLOW);
-			const auto scaled_value = static_cast<destination_t>(static_cast<conversion_float_type>(value) / scale_value);
-			if (std::fetestexcept(FE_UNDERFLOW))
-			{
-				throw fixed_point_conversion_error("Conversion to floating point number caused underflow.");
-			}
+	// writes number into [first, last) without terminating zero, on error returns last and std::errc::value_too_large;
+	// fixed_point_number::max_chars_num characters are always enough
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	std::to_chars_result to_chars(char * first, char * last, const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t> & value)
+	{
+		// simplified version without locale specific formatting
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
+		using unsigned_t = typename std::make_unsigned<value_t>::type;
+
+		constexpr auto written_fraction_digits_num = (fraction_digits_num > 0) ? fraction_digits_num : 1; // zero fraction is written as "0"
 
-			return scaled_value;
+		value_t signed_fractional = 0;
+		const auto signed_integer = details::divide_by_constant<value_t, fixed_point_t::scale_value>(value.raw_value(), signed_fractional);
+
+		// magnitudes are taken in unsigned type as the minimum value has no positive counterpart
+		const bool negative = value.raw_value() < 0;
+		const auto integer = negative ? static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(signed_integer)) : static_cast<unsigned_t>(signed_integer);
+		const auto fractional = negative ? static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(signed_fractional)) : static_cast<unsigned_t>(signed_fractional);
+
+		if (negative)
+		{
+			if (first == last)
+				return { last, std::errc::value_too_large };
+			*first++ = '-';
 		}
 
-		template <typename T>
-		static T mult_div(T value1, T value2, T divisor)
+		// integer digits are produced backwards, so they go to a local buffer first to know their count
+		char integer_chars[std::numeric_limits<unsigned_t>::digits10 + 1];
+		const auto integer_chars_end = integer_chars + sizeof(integer_chars);
+		const auto integer_chars_begin = details::write_digits(integer_chars_end, integer);
+		const auto integer_digits_num = integer_chars_end - integer_chars_begin;
+
+		if (last - first < integer_digits_num + 1 + static_cast<std::ptrdiff_t>(written_fraction_digits_num))
+			return { last, std::errc::value_too_large };
+
+		std::memcpy(first, integer_chars_begin, static_cast<std::size_t>(integer_digits_num));
+		first += integer_digits_num;
+		*first++ = '.';
+
+		const auto fractional_end = first + written_fraction_digits_num;
+		details::write_fixed_digits<written_fraction_digits_num>(fractional_end, fractional);
+
+		return { fractional_end, std::errc() };
+	}
+
+	// parses [-]digits[.digits] straight into the raw value, excess fraction digits are rounded by the round policy;
+	// on error value is not modified and ec is std::errc::invalid_argument or std::errc::result_out_of_range
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	std::from_chars_result from_chars(const char * first, const char * last, fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t> & value)
+	{
+		// simplified version without locale specific formatting and exponent
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
+		using wide_value_t = typename details::next_storage_type<value_t>::type;
+
+		const auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+
+		auto position = first;
+		const bool negative = (position != last && *position == '-');
+		if (negative)
+			++position;
+
+		value_t raw_value = 0;
+		bool overflow = false;
+
+		const auto integer_first = position;
+		position = details::append_decimal_digits(position, last, std::numeric_limits<std::size_t>::max(), negative, raw_value, overflow);
+		bool has_digits = (position != integer_first);
+
+		unsigned int parsed_fraction_digits_num = 0;
+		unsigned int excess_digits_num = 0;
+		value_t rounding_digit = 0; // first excess fraction digit
+		bool sticky = false; // any non-zero excess digit after the rounding one
+
+		if (position != last && *position == '.' && (has_digits || (position + 1 != last && is_digit(position[1]))))
 		{
-			if (divisor == 0)
-			{
-				throw std::invalid_argument("Divisor cannot be zero.");
-			}
+			const auto fraction_first = ++position;
+			position = details::append_decimal_digits(position, last, fraction_digits_num, negative, raw_value, overflow);
+			parsed_fraction_digits_num = static_cast<unsigned int>(position - fraction_first);
+			has_digits = true;
 
-			if (value1 != 0)
+			for (; position != last && is_digit(*position); ++position)
 			{
-				const auto common_divisor = details::gcd(std::abs(value1), std::abs(divisor));
-				if (common_divisor != 1)
+				const auto digit = static_cast<value_t>(*position - '0');
+
+				if (excess_digits_num++ == 0)
 				{
-					value1 = static_cast<T>(value1 / common_divisor);
-					divisor = static_cast<T>(divisor / common_divisor);
+					rounding_digit = digit;
 				}
-			}
-			else return 0;
-
-			if (value2 != 0)
-			{
-				const auto common_divisor = details::gcd(std::abs(value2), std::abs(divisor));
-				if (common_divisor != 1)
+				else
 				{
-					value2 = static_cast<T>(value2 / common_divisor);
-					divisor = static_cast<T>(divisor / common_divisor);
+					sticky = sticky || digit != 0;
 				}
 			}
-			else return 0;
-
-			const auto mult_result = static_cast<T>(value1 * value2);
-			if (mult_result / value1 != value2)
-			{
-				using mult_type_t = decltype(mult_result);
-				using mult_next_storage_t = typename details::next_storage_type<mult_type_t>::type;
-				
-				const auto mult_result_extended = mult_overflow_handler<mult_type_t, mult_next_storage_t>::handle(value1, value2);
-				using result_common_t = typename std::common_type<decltype(mult_result_extended), decltype(divisor)>::type;
-				return range_checked_cast<T>(round_policy_type::round_div(static_cast<result_common_t>(mult_result_extended), static_cast<result_common_t>(divisor)));
-			}
-
-			using result_common_t = typename std::common_type<decltype(mult_result), decltype(divisor)>::type;
-			return range_checked_cast<T>(round_policy_type::round_div(static_cast<result_common_t>(mult_result), static_cast<result_common_t>(divisor)));
 		}
 
-		template <typename mult_type, typename mult_type_extended>
-		struct mult_overflow_handler_impl;
+		if (!has_digits)
+			return { first, std::errc::invalid_argument };
 
-		template <typename mult_type, typename mult_type_extended>
-		struct mult_overflow_handler : mult_overflow_handler_impl<typename std::decay<mult_type>::type, typename std::decay<mult_type_extended>::type>
+		for (; !overflow && parsed_fraction_digits_num < fraction_digits_num; ++parsed_fraction_digits_num)
 		{
-		};
+			overflow = details::scale_overflow(raw_value, value_t(10), raw_value);
+		}
 
-		template <typename mult_type, typename mult_type_extended>
-		struct mult_overflow_handler_impl
+		if (!overflow && (rounding_digit != 0 || sticky))
 		{
-			static mult_type_extended handle(mult_type value1, mult_type value2)
-			{
-				const auto result = static_cast<mult_type_extended>(value1) * static_cast<mult_type_extended>(value2);
-				if (result / value1 != value2)
-				{
-					throw fixed_point_out_of_range_error("Result of multiply/division operation is out of range.");
-				}
-				return result;
-			}
-		};
+			// the rounding digit and a sticky digit standing for the rest are enough for any rounding rule
+			const auto tail = static_cast<wide_value_t>(rounding_digit * 10 + (sticky ? 1 : 0));
+			const auto extended_value = static_cast<wide_value_t>(static_cast<wide_value_t>(raw_value) * 100 + (negative ? -tail : tail));
+			const auto rounded_value = round_policy_t::round_div(extended_value, static_cast<wide_value_t>(100));
 
-		template <typename mult_type>
-		struct mult_overflow_handler_impl<mult_type, mult_type>
-		{
-			static mult_type handle(mult_type, mult_type)
-			{
-				throw fixed_point_out_of_range_error("Result of multiply/division operation is out of range.");
-			}
-		};
+			overflow = details::is_out_of_range<value_t>(rounded_value);
+			raw_value = static_cast<value_t>(rounded_value);
+		}
 
-		using conversion_float_type = long double;
+		if (overflow)
+			return { position, std::errc::result_out_of_range };
 
-		value_type _value;
-	};
+		value = fixed_point_t::from_raw_value(raw_value);
+		return { position, std::errc() };
+	}
 
-	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t>
-	std::string to_string(const fixed_point_number<value_t, fraction_digits_num, round_policy_t> & value)
+	template <typename fixed_point_t>
+	fixed_point_t from_string(const std::string & text)
 	{
-		// simplified version without locale specific formatting
-		const auto parts = value.get_parts();
-		std::string sign;
-		if (parts.negative) sign += '-';
-		const auto fractional = std::to_string(parts.fractional);
-		const auto fract_padding = (fraction_digits_num > fractional.size()) ? std::string(fraction_digits_num - fractional.size(), '0') : std::string();
-		return sign + std::to_string(parts.integer) + '.' + fract_padding + fractional;
+		fixed_point_t value;
+		const auto text_end = text.data() + text.size();
+		const auto result = from_chars(text.data(), text_end, value);
+		if (result.ec == std::errc::result_out_of_range)
+		{
+			throw fixed_point_conversion_error("Number in string is out of range of fixed point number.");
+		}
+		else if (result.ec != std::errc() || result.ptr != text_end)
+		{
+			throw std::invalid_argument("String is not a decimal number.");
+		}
+
+		return value;
 	}
 
-	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t>
-	std::wstring to_wstring(const fixed_point_number<value_t, fraction_digits_num, round_policy_t> & value)
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	std::string to_string(const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t> & value)
 	{
-		// simplified version without locale specific formatting
-		const auto parts = value.get_parts();
-		std::wstring sign;
-		if (parts.negative) sign += L'-';
-		const auto fractional = std::to_wstring(parts.fractional);
-		const auto fract_padding = (fraction_digits_num > fractional.size()) ? std::wstring(fraction_digits_num - fractional.size(), L'0') : std::wstring();
-		return sign + std::to_wstring(parts.integer) + L'.' + fract_padding + fractional;
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
+
+		char buffer[fixed_point_t::max_chars_num];
+		const auto result = to_chars(buffer, buffer + fixed_point_t::max_chars_num, value);
+		return std::string(buffer, result.ptr);
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	std::wstring to_wstring(const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t> & value)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
+
+		char buffer[fixed_point_t::max_chars_num];
+		const auto result = to_chars(buffer, buffer + fixed_point_t::max_chars_num, value);
+		return std::wstring(buffer, result.ptr);
 	}
 
-	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t>
-	std::ostream & operator << (std::ostream & os, const fixed_point_number<value_t, fraction_digits_num, round_policy_t> & value)
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	std::ostream & operator << (std::ostream & os, const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t> & value)
 	{
 		os << to_string(value);
 		return os;
@@ -0,0 +1,781 @@
+// Copyright (c) 2022 Ilia Funtov
+// Distributed under the Boost Software License, Version 1.0. (http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "fixed_point_number.hpp"
+
+// batch operations use vector instructions the compiler is allowed to emit, the scalar code handles the rest;
+// FIXED_POINT_NUMBER_DISABLE_SIMD leaves the scalar code only
+#if !defined(FIXED_POINT_NUMBER_DISABLE_SIMD) && defined(__AVX512F__)
+#define FIXED_POINT_NUMBER_HAS_AVX512
+#endif
+
+#if !defined(FIXED_POINT_NUMBER_DISABLE_SIMD) && defined(__AVX2__)
+#define FIXED_POINT_NUMBER_HAS_AVX2
+#endif
+
+#if defined(FIXED_POINT_NUMBER_HAS_AVX512) || defined(FIXED_POINT_NUMBER_HAS_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace fixed_point_arithmetic
+{
+	namespace details
+	{
+		template <typename source_t, typename destination_t>
+		void check_batch_sizes(const span<source_t> & source, const span<destination_t> & destination)
+		{
+			if (source.size() != destination.size())
+			{
+				throw std::invalid_argument("Spans must have the same size.");
+			}
+		}
+
+		inline fixed_point_status combine_status(fixed_point_status status, fixed_point_status next_status) // keeps the first error
+		{
+			return (status == fixed_point_status::ok) ? next_status : status;
+		}
+
+		template <typename fixed_point_t>
+		fixed_point_status convert_elements(const double * source, fixed_point_t * destination, std::size_t size)
+		{
+			auto status = fixed_point_status::ok;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const auto converted = try_convert<fixed_point_t>(source[i]);
+				if (converted)
+					destination[i] = converted.value();
+				else
+					status = combine_status(status, converted.status());
+			}
+
+			return status;
+		}
+
+		template <typename fixed_point_t>
+		fixed_point_status convert_elements(const fixed_point_t * source, double * destination, std::size_t size)
+		{
+			auto status = fixed_point_status::ok;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const auto converted = try_convert<double>(source[i]);
+				if (converted)
+					destination[i] = converted.value();
+				else
+					status = combine_status(status, converted.status());
+			}
+
+			return status;
+		}
+
+		// vector code reproduces the double conversion path of the default round policy for 32 and 64 bit storage types
+		template <typename fixed_point_t>
+		struct has_vector_double_conversion : std::integral_constant<bool,
+			std::is_same<typename fixed_point_t::round_policy_type, default_round_policy>::value &&
+			(sizeof(typename fixed_point_t::value_type) == 4 || sizeof(typename fixed_point_t::value_type) == 8) &&
+			is_exact_in_float<double>(fixed_point_t::scale_value)> {};
+
+		// range of scaled values handled in lanes: the storage range for 32 bit types,
+		// for 64 bit types the range where integers are converted by adding 2^52 + 2^51 to them;
+		// values rounded into the storage range from beyond its limits are left to the scalar conversion
+		template <typename value_t>
+		constexpr double vector_max_scaled_value()
+		{
+			return (sizeof(value_t) == 4) ? static_cast<double>(std::numeric_limits<value_t>::max()) : 2251799813685247.0; // 2^51 - 1
+		}
+
+		template <typename value_t>
+		constexpr double vector_min_scaled_value()
+		{
+			return (sizeof(value_t) == 4) ? static_cast<double>(std::numeric_limits<value_t>::min()) : -2251799813685247.0;
+		}
+
+		constexpr double integer_conversion_magic = 6755399441055744.0; // 2^52 + 2^51
+
+#if defined(FIXED_POINT_NUMBER_HAS_AVX512)
+		// lanes needing the exact scalar conversion (errors, halves whose rounding depends on the product error,
+		// values out of the vector range) make the whole block fall back to it
+		template <typename value_t>
+		bool convert_block(const double * source, value_t * destination, double scale_value)
+		{
+			const auto value = _mm512_mul_pd(_mm512_loadu_pd(source), _mm512_set1_pd(scale_value));
+			const auto truncated = _mm512_roundscale_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+			const auto fraction = _mm512_abs_pd(_mm512_sub_pd(value, truncated));
+			const auto half = _mm512_set1_pd(0.5);
+
+			const auto exact_lanes =
+				_mm512_cmp_pd_mask(value, _mm512_set1_pd(vector_min_scaled_value<value_t>()), _CMP_GE_OQ) &
+				_mm512_cmp_pd_mask(value, _mm512_set1_pd(vector_max_scaled_value<value_t>()), _CMP_LE_OQ) &
+				_mm512_cmp_pd_mask(fraction, half, _CMP_NEQ_OQ);
+			if (exact_lanes != 0xFF)
+				return false;
+
+			// half away from zero: truncated value moves by one with the sign of value when the fraction is above half
+			const auto sign_bits = _mm512_and_si512(_mm512_castpd_si512(value), _mm512_castpd_si512(_mm512_set1_pd(-0.0)));
+			const auto signed_one = _mm512_castsi512_pd(_mm512_or_si512(sign_bits, _mm512_castpd_si512(_mm512_set1_pd(1.0))));
+			const auto rounded = _mm512_mask_add_pd(truncated, _mm512_cmp_pd_mask(fraction, half, _CMP_GT_OQ), truncated, signed_one);
+
+			if constexpr (sizeof(value_t) == 4)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), _mm512_cvtpd_epi32(rounded));
+			}
+			else
+			{
+				const auto magic = _mm512_set1_pd(integer_conversion_magic);
+				const auto integers = _mm512_sub_epi64(_mm512_castpd_si512(_mm512_add_pd(rounded, magic)), _mm512_castpd_si512(magic));
+				_mm512_storeu_si512(destination, integers);
+			}
+
+			return true;
+		}
+
+		template <typename value_t>
+		bool convert_block(const value_t * source, double * destination, double scale_value)
+		{
+			__m512d value;
+			if constexpr (sizeof(value_t) == 4)
+			{
+				value = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(source)));
+			}
+			else
+			{
+				const auto integers = _mm512_loadu_si512(source);
+				const auto limit = _mm512_set1_epi64(2251799813685247); // 2^51 - 1
+				if ((_mm512_cmple_epi64_mask(integers, limit) & _mm512_cmpge_epi64_mask(integers, _mm512_sub_epi64(_mm512_setzero_si512(), limit))) != 0xFF)
+					return false;
+
+				const auto magic = _mm512_set1_pd(integer_conversion_magic);
+				value = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_add_epi64(integers, _mm512_castpd_si512(magic))), magic);
+			}
+
+			_mm512_storeu_pd(destination, _mm512_div_pd(value, _mm512_set1_pd(scale_value)));
+			return true;
+		}
+
+		constexpr std::size_t vector_lanes_num = 8;
+#elif defined(FIXED_POINT_NUMBER_HAS_AVX2)
+		// lanes needing the exact scalar conversion (errors, halves whose rounding depends on the product error,
+		// values out of the vector range) make the whole block fall back to it
+		template <typename value_t>
+		bool convert_block(const double * source, value_t * destination, double scale_value)
+		{
+			const auto value = _mm256_mul_pd(_mm256_loadu_pd(source), _mm256_set1_pd(scale_value));
+			const auto truncated = _mm256_round_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+			const auto sign_mask = _mm256_set1_pd(-0.0);
+			const auto fraction = _mm256_andnot_pd(sign_mask, _mm256_sub_pd(value, truncated));
+			const auto half = _mm256_set1_pd(0.5);
+
+			const auto exact_lanes = _mm256_and_pd(
+				_mm256_and_pd(
+					_mm256_cmp_pd(value, _mm256_set1_pd(vector_min_scaled_value<value_t>()), _CMP_GE_OQ),
+					_mm256_cmp_pd(value, _mm256_set1_pd(vector_max_scaled_value<value_t>()), _CMP_LE_OQ)),
+				_mm256_cmp_pd(fraction, half, _CMP_NEQ_OQ));
+			if (_mm256_movemask_pd(exact_lanes) != 0xF)
+				return false;
+
+			// half away from zero: truncated value moves by one with the sign of value when the fraction is above half
+			const auto signed_one = _mm256_or_pd(_mm256_and_pd(value, sign_mask), _mm256_set1_pd(1.0));
+			const auto rounded = _mm256_add_pd(truncated, _mm256_and_pd(_mm256_cmp_pd(fraction, half, _CMP_GT_OQ), signed_one));
+
+			if constexpr (sizeof(value_t) == 4)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm256_cvtpd_epi32(rounded));
+			}
+			else
+			{
+				const auto magic = _mm256_set1_pd(integer_conversion_magic);
+				const auto integers = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(rounded, magic)), _mm256_castpd_si256(magic));
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), integers);
+			}
+
+			return true;
+		}
+
+		template <typename value_t>
+		bool convert_block(const value_t * source, double * destination, double scale_value)
+		{
+			__m256d value;
+			if constexpr (sizeof(value_t) == 4)
+			{
+				value = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source)));
+			}
+			else
+			{
+				const auto integers = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+				const auto limit = _mm256_set1_epi64x(2251799813685248); // 2^51
+				const auto in_range = _mm256_and_si256(
+					_mm256_cmpgt_epi64(limit, integers),
+					_mm256_cmpgt_epi64(integers, _mm256_sub_epi64(_mm256_setzero_si256(), limit)));
+				if (_mm256_movemask_pd(_mm256_castsi256_pd(in_range)) != 0xF)
+					return false;
+
+				const auto magic = _mm256_set1_pd(integer_conversion_magic);
+				value = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(integers, _mm256_castpd_si256(magic))), magic);
+			}
+
+			_mm256_storeu_pd(destination, _mm256_div_pd(value, _mm256_set1_pd(scale_value)));
+			return true;
+		}
+
+		constexpr std::size_t vector_lanes_num = 4;
+#else
+		constexpr std::size_t vector_lanes_num = 0;
+#endif
+
+		template <typename source_t, typename destination_t>
+		fixed_point_status convert_batch_impl(const source_t * source, destination_t * destination, std::size_t size)
+		{
+			using fixed_point_t = typename std::conditional<std::is_same<source_t, double>::value, destination_t, source_t>::type;
+			using value_t = typename fixed_point_t::value_type;
+			check_raw_layout<fixed_point_t, value_t>();
+
+			auto status = fixed_point_status::ok;
+			std::size_t i = 0;
+
+			if constexpr (vector_lanes_num > 0 && has_vector_double_conversion<fixed_point_t>::value)
+			{
+				using raw_source_t = typename std::conditional<std::is_same<source_t, double>::value, const double, const value_t>::type;
+				using raw_destination_t = typename std::conditional<std::is_same<source_t, double>::value, value_t, double>::type;
+
+				const auto raw_source = reinterpret_cast<raw_source_t *>(source);
+				const auto raw_destination = reinterpret_cast<raw_destination_t *>(destination);
+				constexpr auto scale_value = static_cast<double>(fixed_point_t::scale_value);
+
+				for (; i + vector_lanes_num <= size; i += vector_lanes_num)
+				{
+					if (!convert_block(raw_source + i, raw_destination + i, scale_value))
+						status = combine_status(status, convert_elements(source + i, destination + i, vector_lanes_num));
+				}
+			}
+
+			return combine_status(status, convert_elements(source + i, destination + i, size - i));
+		}
+
+		// sign bit of the result is set when the wrapped around sum or difference differs from the exact one:
+		// the sum has the sign other than the sign of both operands, the difference has the sign of the subtrahend
+		// while the operands have different signs
+		template <bool subtraction, typename value_t>
+		constexpr value_t overflow_sign(value_t a, value_t b, value_t result)
+		{
+			return subtraction ? static_cast<value_t>((a ^ b) & (a ^ result)) : static_cast<value_t>((a ^ result) & (b ^ result));
+		}
+
+		template <bool subtraction, typename value_t>
+		constexpr value_t wrapping_add_subtract(value_t a, value_t b)
+		{
+			return subtraction ? wrapping_subtract(a, b) : wrapping_add(a, b);
+		}
+
+		// returns the index of the first overflow in the block or size if there is none; results go through a buffer
+		// as out may be the same as a or b and the overflowed element is searched for only after the whole block is checked
+		template <bool subtraction, typename value_t>
+		std::size_t add_subtract_elements(const value_t * a, const value_t * b, value_t * out, std::size_t size)
+		{
+			value_t results[64];
+			value_t overflow = 0;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				results[i] = wrapping_add_subtract<subtraction>(a[i], b[i]);
+				overflow = static_cast<value_t>(overflow | overflow_sign<subtraction>(a[i], b[i], results[i]));
+			}
+
+			std::size_t first_overflow = size;
+			if (overflow < 0)
+			{
+				for (first_overflow = 0; overflow_sign<subtraction>(a[first_overflow], b[first_overflow], results[first_overflow]) >= 0; ++first_overflow) {}
+			}
+
+			std::memcpy(out, results, size * sizeof(value_t));
+			return first_overflow;
+		}
+
+		inline std::size_t first_lane(unsigned int lanes_mask) // lanes_mask must not be zero
+		{
+			std::size_t lane = 0;
+			for (; (lanes_mask & 1u) == 0; lanes_mask >>= 1)
+				++lane;
+
+			return lane;
+		}
+
+#if defined(FIXED_POINT_NUMBER_HAS_AVX512)
+		template <bool subtraction, typename value_t>
+		std::size_t add_subtract_block(const value_t * a, const value_t * b, value_t * out)
+		{
+			const auto lhs = _mm512_loadu_si512(a);
+			const auto rhs = _mm512_loadu_si512(b);
+			__m512i result;
+			__m512i overflow;
+			unsigned int lanes_mask;
+
+			if constexpr (sizeof(value_t) == 4)
+				result = subtraction ? _mm512_sub_epi32(lhs, rhs) : _mm512_add_epi32(lhs, rhs);
+			else
+				result = subtraction ? _mm512_sub_epi64(lhs, rhs) : _mm512_add_epi64(lhs, rhs);
+
+			if constexpr (subtraction)
+				overflow = _mm512_and_si512(_mm512_xor_si512(lhs, rhs), _mm512_xor_si512(lhs, result));
+			else
+				overflow = _mm512_and_si512(_mm512_xor_si512(lhs, result), _mm512_xor_si512(rhs, result));
+
+			if constexpr (sizeof(value_t) == 4)
+				lanes_mask = _mm512_test_epi32_mask(overflow, _mm512_set1_epi32(std::numeric_limits<std::int32_t>::min()));
+			else
+				lanes_mask = _mm512_test_epi64_mask(overflow, _mm512_set1_epi64(std::numeric_limits<std::int64_t>::min()));
+
+			_mm512_storeu_si512(out, result);
+			return (lanes_mask == 0) ? 64 / sizeof(value_t) : first_lane(lanes_mask);
+		}
+
+		constexpr std::size_t vector_bytes_num = 64;
+#elif defined(FIXED_POINT_NUMBER_HAS_AVX2)
+		template <bool subtraction, typename value_t>
+		std::size_t add_subtract_block(const value_t * a, const value_t * b, value_t * out)
+		{
+			const auto lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a));
+			const auto rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b));
+			__m256i result;
+			__m256i overflow;
+			unsigned int lanes_mask;
+
+			if constexpr (sizeof(value_t) == 4)
+				result = subtraction ? _mm256_sub_epi32(lhs, rhs) : _mm256_add_epi32(lhs, rhs);
+			else
+				result = subtraction ? _mm256_sub_epi64(lhs, rhs) : _mm256_add_epi64(lhs, rhs);
+
+			if constexpr (subtraction)
+				overflow = _mm256_and_si256(_mm256_xor_si256(lhs, rhs), _mm256_xor_si256(lhs, result));
+			else
+				overflow = _mm256_and_si256(_mm256_xor_si256(lhs, result), _mm256_xor_si256(rhs, result));
+
+			if constexpr (sizeof(value_t) == 4)
+				lanes_mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(overflow)));
+			else
+				lanes_mask = static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(overflow)));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(out), result);
+			return (lanes_mask == 0) ? 32 / sizeof(value_t) : first_lane(lanes_mask);
+		}
+
+		constexpr std::size_t vector_bytes_num = 32;
+#endif
+
+		constexpr std::size_t add_subtract_block_size = 64; // size of the buffer in add_subtract_elements
+
+		template <bool subtraction, typename fixed_point_t>
+		std::size_t add_subtract_batch_impl(const fixed_point_t * a, const fixed_point_t * b, fixed_point_t * out, std::size_t size)
+		{
+			using value_t = typename fixed_point_t::value_type;
+			check_raw_layout<fixed_point_t, value_t>();
+
+			const auto raw_a = reinterpret_cast<const value_t *>(a);
+			const auto raw_b = reinterpret_cast<const value_t *>(b);
+			const auto raw_out = reinterpret_cast<value_t *>(out);
+
+			auto first_overflow = size;
+			std::size_t i = 0;
+
+#if defined(FIXED_POINT_NUMBER_HAS_AVX512) || defined(FIXED_POINT_NUMBER_HAS_AVX2)
+			if constexpr (sizeof(value_t) == 4 || sizeof(value_t) == 8)
+			{
+				constexpr std::size_t lanes_num = vector_bytes_num / sizeof(value_t);
+				for (; i + lanes_num <= size; i += lanes_num)
+				{
+					const auto lane = add_subtract_block<subtraction>(raw_a + i, raw_b + i, raw_out + i);
+					if (lane < lanes_num && first_overflow == size)
+						first_overflow = i + lane;
+				}
+			}
+#endif
+
+			// constant size of full blocks lets the compiler vectorize them
+			for (; i + add_subtract_block_size <= size; i += add_subtract_block_size)
+			{
+				const auto index = add_subtract_elements<subtraction>(raw_a + i, raw_b + i, raw_out + i, add_subtract_block_size);
+				if (index < add_subtract_block_size && first_overflow == size)
+					first_overflow = i + index;
+			}
+
+			if (i == size) // spans of no elements may have null data, which memcpy does not accept
+				return first_overflow;
+
+			const auto index = add_subtract_elements<subtraction>(raw_a + i, raw_b + i, raw_out + i, size - i);
+			return (first_overflow == size && index < size - i) ? i + index : first_overflow;
+		}
+
+		// rounds the product as default_round_policy::round_div_by_constant does, but without branches:
+		// remainders and signs of random data would make them unpredictable
+		template <typename value_t, value_t scale_value, typename mult_type_t>
+		constexpr typename std::enable_if<!is_double_word_integer<mult_type_t>::value, bool>::type scale_element(value_t value, value_t factor, value_t & result)
+		{
+			constexpr auto half_scale_value = static_cast<mult_type_t>(scale_value - scale_value / 2);
+
+			mult_type_t remainder = 0;
+			auto product = divide_by_constant<value_t, scale_value>(static_cast<mult_type_t>(static_cast<mult_type_t>(value) * factor), remainder);
+			product += static_cast<mult_type_t>(remainder >= half_scale_value) - static_cast<mult_type_t>(remainder <= -half_scale_value);
+
+			result = static_cast<value_t>(product);
+			return !is_out_of_range<value_t>(product);
+		}
+
+		// value * factor / divisor rounded half away from zero as default_round_policy::round_div does, false if it is out of range;
+		// the double word product is divided in magnitude by the precomputed reciprocal without branches
+		template <typename value_t>
+		constexpr bool mult_round_div(value_t value, value_t factor, const invariant_divisor & divider, value_t & result)
+		{
+			const auto value_sign = std::uint64_t(0) - static_cast<std::uint64_t>(value < 0); // all ones for negative numbers
+			const auto factor_sign = std::uint64_t(0) - static_cast<std::uint64_t>(factor < 0);
+			const auto sign = value_sign ^ factor_sign;
+
+			std::uint64_t high = 0;
+			const auto low = multiply_words((static_cast<std::uint64_t>(value) ^ value_sign) - value_sign, (static_cast<std::uint64_t>(factor) ^ factor_sign) - factor_sign, high);
+			const auto in_word = high < divider.divisor(); // otherwise the quotient does not fit into a word
+
+			std::uint64_t remainder = 0;
+			auto quotient = divider.divide(in_word ? high : 0, low, remainder);
+			quotient += (remainder >= divider.divisor() - remainder) ? 1 : 0;
+
+			result = static_cast<value_t>((quotient ^ sign) - sign);
+			return in_word && quotient <= static_cast<std::uint64_t>(std::numeric_limits<value_t>::max()) - sign; // - sign adds one for negative results
+		}
+
+		template <typename value_t, value_t scale_value, typename mult_type_t>
+		constexpr typename std::enable_if<is_double_word_integer<mult_type_t>::value, bool>::type scale_element(value_t value, value_t factor, value_t & result)
+		{
+			return mult_round_div(value, factor, constant_invariant_divisor<value_t, scale_value>::value, result);
+		}
+
+		// operation returns false for results out of range: such elements are kept by a select
+		// and the status is accumulated for the whole batch instead of branching on every element
+		template <typename fixed_point_t, typename operation_t>
+		fixed_point_status transform_elements(const fixed_point_t * source, fixed_point_t * destination, std::size_t size, operation_t operation)
+		{
+			using value_t = typename fixed_point_t::value_type;
+			check_raw_layout<fixed_point_t, value_t>();
+
+			const auto raw_source = reinterpret_cast<const value_t *>(source);
+			const auto raw_destination = reinterpret_cast<value_t *>(destination);
+
+			bool out_of_range = false;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				value_t result = 0;
+				const bool in_range = operation(raw_source[i], result);
+				raw_destination[i] = in_range ? result : raw_destination[i];
+				out_of_range |= !in_range;
+			}
+
+			return out_of_range ? fixed_point_status::out_of_range : fixed_point_status::ok;
+		}
+
+		// for custom round policies: operation is a non-throwing operator, errors leave elements unchanged
+		template <typename fixed_point_t, typename operation_t>
+		fixed_point_status checked_elements(const fixed_point_t * source, fixed_point_t * destination, std::size_t size, operation_t operation)
+		{
+			auto status = fixed_point_status::ok;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const auto result = operation(source[i]);
+				if (result)
+					destination[i] = result.value();
+				else
+					status = combine_status(status, result.status());
+			}
+
+			return status;
+		}
+
+		template <typename fixed_point_t>
+		fixed_point_status scale_batch_impl(const fixed_point_t * source, const fixed_point_t & factor, fixed_point_t * destination, std::size_t size)
+		{
+			using value_t = typename fixed_point_t::value_type;
+			using mult_type_t = typename next_storage_type<value_t>::type;
+
+			if constexpr (std::is_same<typename fixed_point_t::round_policy_type, default_round_policy>::value)
+			{
+				const auto raw_factor = factor.raw_value();
+
+				// factor / scale_value reduced once: the product of a whole number is exact and is not divided back
+				if (raw_factor % fixed_point_t::scale_value == 0)
+				{
+					const auto integer_factor = static_cast<mult_type_t>(raw_factor / fixed_point_t::scale_value);
+					return transform_elements(source, destination, size, [integer_factor](value_t value, value_t & result)
+					{
+						const auto product = static_cast<mult_type_t>(static_cast<mult_type_t>(value) * integer_factor);
+						result = static_cast<value_t>(product);
+						return !is_out_of_range<value_t>(product);
+					});
+				}
+
+				return transform_elements(source, destination, size, [raw_factor](value_t value, value_t & result)
+				{
+					return scale_element<value_t, fixed_point_t::scale_value, mult_type_t>(value, raw_factor, result);
+				});
+			}
+			else // custom round policy, nothing to precompute
+			{
+				return checked_elements(source, destination, size, [&factor](const fixed_point_t & value) { return try_mul(value, factor); });
+			}
+		}
+
+		// sums of up to 2^31 terms of 32 bits in 64 bit integers cannot overflow, so the loops have no checks and are vectorized
+		constexpr std::size_t reduction_chunk_size = std::size_t(1) << 31;
+
+		// exact sum of terms no wider than 64 bits, 64 bit terms are split into the signed high and the unsigned low halves
+		template <typename term_t, typename term_func_t>
+		int128_t sum_terms(std::size_t size, term_func_t term)
+		{
+			int128_t total = 0;
+			for (std::size_t begin = 0; begin < size;)
+			{
+				const auto end = (size - begin > reduction_chunk_size) ? begin + reduction_chunk_size : size;
+				if constexpr (sizeof(term_t) < sizeof(std::int64_t))
+				{
+					std::int64_t chunk_sum = 0;
+					for (auto i = begin; i < end; ++i)
+						chunk_sum += term(i);
+
+					total += int128_t(chunk_sum);
+				}
+				else
+				{
+					std::int64_t high_sum = 0;
+					std::uint64_t low_sum = 0;
+					for (auto i = begin; i < end; ++i)
+					{
+						const auto value = static_cast<std::int64_t>(term(i));
+						high_sum += static_cast<std::int32_t>(value >> 32);
+						low_sum += static_cast<std::uint32_t>(value);
+					}
+
+					total += int128_t(high_sum) * int128_t(std::int64_t(1) << 32) + int128_t(low_sum);
+				}
+
+				begin = end;
+			}
+
+			return total;
+		}
+
+		// exact sum of double word products: low words are added with carries and high words in a double word,
+		// false if the sum does not fit into a double word
+		template <typename value_t>
+		bool sum_double_word_products(const value_t * a, const value_t * b, std::size_t size, int128_t & total)
+		{
+			int128_t high_sum = 0;
+			std::uint64_t low_sum = 0;
+			std::uint64_t carries = 0;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				std::uint64_t high = 0;
+				std::uint64_t low = 0;
+				to_words(int128_t(a[i]) * int128_t(b[i]), high, low);
+
+				high_sum += int128_t(static_cast<std::int64_t>(high));
+				low_sum += low;
+				carries += (low_sum < low) ? 1 : 0;
+			}
+
+			high_sum += int128_t(carries);
+			if (is_out_of_range<std::int64_t>(high_sum))
+				return false;
+
+			from_words(static_cast<std::uint64_t>(static_cast<std::int64_t>(high_sum)), low_sum, total);
+			return true;
+		}
+
+		template <typename fixed_point_t>
+		checked_result<fixed_point_t> make_reduction_result(const int128_t & raw_value)
+		{
+			using value_t = typename fixed_point_t::value_type;
+
+			if (is_out_of_range<value_t>(raw_value))
+				return fixed_point_status::out_of_range;
+
+			return fixed_point_t::from_raw_value(static_cast<value_t>(raw_value));
+		}
+	}
+
+	// converts every element as try_convert does and returns the first error status or ok;
+	// elements which cannot be converted are left unchanged, spans must have the same size
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	fixed_point_status convert_batch(span<const double> source, span<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> destination)
+	{
+		details::check_batch_sizes(source, destination);
+		return details::convert_batch_impl(source.data(), destination.data(), source.size());
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	fixed_point_status convert_batch(span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> source, span<double> destination)
+	{
+		details::check_batch_sizes(source, destination);
+		return details::convert_batch_impl(source.data(), destination.data(), source.size());
+	}
+
+	// out[i] = a[i] + b[i] wrapped around on overflow; returns the index of the first sum out of range or the size of spans
+	// if there is none, so the range is checked once for the whole batch; spans must have the same size, out may be a or b
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	std::size_t add(span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> a,
+		span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> b,
+		span<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> out)
+	{
+		details::check_batch_sizes(a, b);
+		details::check_batch_sizes(a, out);
+		return details::add_subtract_batch_impl<false>(a.data(), b.data(), out.data(), a.size());
+	}
+
+	// out[i] = a[i] - b[i] wrapped around on overflow; returns the index of the first difference out of range as add does
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	std::size_t sub(span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> a,
+		span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> b,
+		span<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> out)
+	{
+		details::check_batch_sizes(a, b);
+		details::check_batch_sizes(a, out);
+		return details::add_subtract_batch_impl<true>(a.data(), b.data(), out.data(), a.size());
+	}
+
+	// multiplies every element by factor as try_mul does and returns the first error status or ok;
+	// products out of range are left unchanged, spans must have the same size, destination may be source
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	fixed_point_status scale_batch(span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> source,
+		const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t> & factor,
+		span<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> destination)
+	{
+		details::check_batch_sizes(source, destination);
+		return details::scale_batch_impl(source.data(), factor, destination.data(), source.size());
+	}
+
+	// divisor with its reciprocal precomputed, so that dividing many numbers by it needs no hardware division;
+	// results are the same as of try_div by the divisor
+	template <typename fixed_point_t>
+	class fixed_point_divisor
+	{
+	public:
+		static_assert(details::is_fixed_point_number<fixed_point_t>::value, "Divisor must be a fixed point number.");
+
+		using value_type = typename fixed_point_t::value_type;
+
+		explicit fixed_point_divisor(const fixed_point_t & divisor) :
+			_divisor(divisor),
+			_factor((divisor.raw_value() < 0) ? static_cast<value_type>(-fixed_point_t::scale_value) : fixed_point_t::scale_value),
+			_divider(checked_magnitude(divisor.raw_value()))
+		{
+		}
+
+		const fixed_point_t & value() const
+		{
+			return _divisor;
+		}
+
+		friend checked_result<fixed_point_t> try_div(const fixed_point_t & lhs, const fixed_point_divisor & rhs)
+		{
+			if constexpr (has_reciprocal::value)
+			{
+				value_type result = 0;
+				if (!details::mult_round_div(lhs.raw_value(), rhs._factor, rhs._divider, result))
+					return fixed_point_status::out_of_range;
+
+				return fixed_point_t::from_raw_value(result);
+			}
+			else
+			{
+				return try_div(lhs, rhs._divisor);
+			}
+		}
+
+		// divides every element as try_div does and returns the first error status or ok;
+		// quotients out of range are left unchanged, spans must have the same size, destination may be source
+		friend fixed_point_status divide_batch(span<const fixed_point_t> source, const fixed_point_divisor & divisor, span<fixed_point_t> destination)
+		{
+			details::check_batch_sizes(source, destination);
+
+			if constexpr (has_reciprocal::value)
+			{
+				return details::transform_elements(source.data(), destination.data(), source.size(), [&divisor](value_type value, value_type & result)
+				{
+					return details::mult_round_div(value, divisor._factor, divisor._divider, result);
+				});
+			}
+			else
+			{
+				return details::checked_elements(source.data(), destination.data(), source.size(),
+					[&divisor](const fixed_point_t & value) { return try_div(value, divisor._divisor); });
+			}
+		}
+
+	private:
+		// the reciprocal reproduces rounding of the default round policy only
+		using has_reciprocal = std::is_same<typename fixed_point_t::round_policy_type, default_round_policy>;
+
+		static std::uint64_t checked_magnitude(value_type divisor)
+		{
+			if (divisor == 0)
+			{
+				throw std::invalid_argument("Divisor cannot be zero.");
+			}
+
+			return (divisor < 0) ? std::uint64_t(0) - static_cast<std::uint64_t>(divisor) : static_cast<std::uint64_t>(divisor);
+		}
+
+		fixed_point_t _divisor;
+		value_type _factor; // scale value with the sign of divisor
+		details::invariant_divisor _divider;
+	};
+
+	// exact sum of all elements checked for range once, so that intermediate sums out of range do not matter
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	checked_result<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> sum(
+		span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> values)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
+		details::check_raw_layout<fixed_point_t, value_t>();
+
+		const auto raw_values = reinterpret_cast<const value_t *>(values.data());
+		return details::make_reduction_result<fixed_point_t>(details::sum_terms<value_t>(values.size(), [raw_values](std::size_t i) { return raw_values[i]; }));
+	}
+
+	// sum of products of elements: products are added exactly and the sum is rounded and checked for range once,
+	// so it may differ from the sum of try_mul results; spans must have the same size
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename overflow_policy_t, typename observer_policy_t>
+	checked_result<fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> dot(
+		span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> a,
+		span<const fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>> b)
+	{
+		using fixed_point_t = fixed_point_number<value_t, fraction_digits_num, round_policy_t, overflow_policy_t, observer_policy_t>;
+		using mult_type_t = typename details::next_storage_type<value_t>::type;
+		details::check_raw_layout<fixed_point_t, value_t>();
+		details::check_batch_sizes(a, b);
+
+		const auto raw_a = reinterpret_cast<const value_t *>(a.data());
+		const auto raw_b = reinterpret_cast<const value_t *>(b.data());
+
+		details::int128_t total = 0;
+		if constexpr (details::is_double_word_integer<mult_type_t>::value)
+		{
+			if (!details::sum_double_word_products(raw_a, raw_b, a.size(), total))
+				return fixed_point_status::out_of_range;
+		}
+		else
+		{
+			total = details::sum_terms<mult_type_t>(a.size(), [raw_a, raw_b](std::size_t i)
+			{
+				return static_cast<mult_type_t>(static_cast<mult_type_t>(raw_a[i]) * static_cast<mult_type_t>(raw_b[i]));
+			});
+		}
+
+		if constexpr (details::has_round_div_by_constant<round_policy_t, details::int128_t, value_t>::value)
+			total = round_policy_t::template round_div_by_constant<value_t, fixed_point_t::scale_value>(total);
+		else
+			total = round_policy_t::round_div(total, details::int128_t(fixed_point_t::scale_value));
+
+		return details::make_reduction_result<fixed_point_t>(total);
+	}
+}
@@ -0,0 +1,128 @@
+// Copyright (c) 2022 Ilia Funtov
+// Distributed under the Boost Software License, Version 1.0. (http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+#include "fixed_point_number.hpp"
+
+namespace fixed_point_arithmetic
+{
+	constexpr std::size_t fixed_point_operations_num = 5; // number of fixed_point_operation values
+
+	struct fixed_point_counters
+	{
+		std::array<std::uint64_t, fixed_point_operations_num> operations{}; // indexed by fixed_point_operation
+		std::uint64_t near_overflow_results = 0;
+		std::uint64_t round_divisions = 0;
+		std::uint64_t inexact_round_divisions = 0; // the ones that actually rounded
+
+		std::uint64_t operator [] (fixed_point_operation operation) const
+		{
+			return operations[static_cast<std::size_t>(operation)];
+		}
+	};
+
+	// counts operators and rounding divisions of every fixed_point_number type using it, separately for each thread;
+	// operator results with fewer than headroom_bits unused high bits are counted as near overflow
+	template <unsigned int headroom_bits = 1>
+	class counting_observer_policy
+	{
+	public:
+		template <typename fixed_point_t>
+		static fixed_point_counters & counters() // of the calling thread
+		{
+			thread_local auto & type_counters = register_counters(type_label<fixed_point_t>());
+			return type_counters;
+		}
+
+		static void reset() // all counters of the calling thread
+		{
+			for (auto & entry : registry())
+				entry.second = fixed_point_counters();
+		}
+
+		static void dump(std::ostream & os) // all counters of the calling thread, a line per type
+		{
+			constexpr const char * operation_names[fixed_point_operations_num] = { "add", "subtract", "multiply", "divide", "negate" };
+
+			for (const auto & entry : registry())
+			{
+				os << entry.first << ':';
+				for (std::size_t i = 0; i < fixed_point_operations_num; ++i)
+					os << ' ' << operation_names[i] << ' ' << entry.second.operations[i];
+				os << " near_overflow " << entry.second.near_overflow_results
+					<< " round_div " << entry.second.round_divisions
+					<< " inexact_round_div " << entry.second.inexact_round_divisions << '\n';
+			}
+		}
+
+		template <typename fixed_point_t>
+		static void on_operation(fixed_point_operation operation, typename fixed_point_t::value_type result)
+		{
+			using value_t = typename fixed_point_t::value_type;
+			static_assert(headroom_bits > 0 && headroom_bits < std::numeric_limits<value_t>::digits, "Headroom must leave some bits of the storage type.");
+			constexpr value_t limit = std::numeric_limits<value_t>::max() >> headroom_bits;
+
+			auto & type_counters = counters<fixed_point_t>();
+			++type_counters.operations[static_cast<std::size_t>(operation)];
+			if (result > limit || result < -limit)
+				++type_counters.near_overflow_results;
+		}
+
+		template <typename fixed_point_t, typename value_t>
+		static void on_round_div(value_t dividend, value_t divisor, value_t) // with the rounded quotient
+		{
+			auto & type_counters = counters<fixed_point_t>();
+			++type_counters.round_divisions;
+
+			// multiplying the rounded quotient back may overflow value_t near the storage type boundaries, the remainder cannot
+			if (dividend % divisor != 0)
+				++type_counters.inexact_round_divisions;
+		}
+
+	private:
+		using registry_type = std::deque<std::pair<std::string, fixed_point_counters>>; // keeps references to elements on insertion
+
+		static registry_type & registry()
+		{
+			thread_local registry_type entries;
+			return entries;
+		}
+
+		static fixed_point_counters & register_counters(std::string label)
+		{
+			auto & entries = registry();
+			entries.emplace_back(std::move(label), fixed_point_counters());
+			return entries.back().second;
+		}
+
+		template <typename fixed_point_t>
+		static std::string type_label() // the exact type, types differing only in storage type or policies get separate lines
+		{
+			const char * name = typeid(fixed_point_t).name();
+#if defined(__GNUG__)
+			int status = 0;
+			const std::unique_ptr<char, void (*)(void *)> demangled_name(abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free);
+			if (status == 0)
+				return demangled_name.get();
+#endif
+			return name;
+		}
+	};
+}
@@ -2,15 +2,24 @@
 // Distributed under the Boost Software License, Version 1.0. (http://www.boost.org/LICENSE_1_0.txt)
 
 #include <algorithm>
+#include <cfenv>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <limits>
+#include <sstream>
+#include <string>
+#include <system_error>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <fixed_point_number.hpp>
+#include <fixed_point_number_batch.hpp>
+#include <fixed_point_number_instrumentation.hpp>
 
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
@@ -94,12 +103,8 @@ namespace fixed_point_arithmetic
 		if (value == 0)
 			return 0;
 
-		auto result = static_cast<value_t>(-value);
-		if (result == value)
-		{
-			result = (result < 0) ? result + 1 : result - 1;
-			result = -result;
-		}
+		// negation of the minimum value does not fit, the nearest opposite value is the maximum one
+		const auto result = (value == std::numeric_limits<value_t>::min()) ? std::numeric_limits<value_t>::max() : static_cast<value_t>(-value);
 
 		REQUIRE(result != value);
 
@@ -238,7 +243,7 @@ namespace fixed_point_arithmetic
 			static_cast<common_type>(std::numeric_limits<test_value_t>::max()),
 			static_cast<common_type>(std::numeric_limits<value_t>::max()));
 
-		const auto root_min = -static_cast<decltype(min_value)>(std::sqrt(std::abs(min_value / scale_value)));
+		const auto root_min = -static_cast<decltype(min_value)>(std::sqrt(-static_cast<double>(min_value / scale_value))); // std::abs of the minimum value overflows
 		const auto root_max = static_cast<decltype(max_value)>(std::sqrt(std::abs(max_value / scale_value)));
 
 		result.push_back(0);
@@ -1054,6 +1059,31 @@ namespace fixed_point_arithmetic
 		}
 	}
 
+	TEMPLATE_LIST_TEST_CASE("Multiply divide rounding", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+
+		const fixed_point_type a = 0.05;
+		const fixed_point_type b = 0.5;
+		const fixed_point_type c = 0.04;
+		const fixed_point_type d = 0.1;
+		const fixed_point_type e = 0.2;
+		const fixed_point_type f = 0.3;
+
+		REQUIRE(a * b == 0.03);
+		REQUIRE(-a * b == -0.03);
+		REQUIRE(a * -b == -0.03);
+		REQUIRE(-a * -b == 0.03);
+		REQUIRE(c * b == 0.02);
+		REQUIRE(-c * b == -0.02);
+
+		REQUIRE(d / f == 0.33);
+		REQUIRE(e / f == 0.67);
+		REQUIRE(-e / f == -0.67);
+		REQUIRE(e / -f == -0.67);
+		REQUIRE(-e / -f == 0.67);
+	}
+
 	TEMPLATE_LIST_TEST_CASE("Increment and decrement operators", "", template_test_types)
 	{
 		using fixed_point_type = fixed_point_number<TestType, 2>;
@@ -1098,6 +1128,44 @@ namespace fixed_point_arithmetic
 		REQUIRE_THROWS_AS(-val, fixed_point_out_of_range_error);
 	}
 
+	TEMPLATE_LIST_TEST_CASE("Overflow at storage type boundaries", "", template_test_types)
+	{
+		// every check below used to compute the overflowing value first, build with FIXED_POINT_NUMBER_SANITIZE=ON to verify
+		using fixed_point_type = fixed_point_number<TestType, 0>;
+		const fixed_point_type max_value = std::numeric_limits<TestType>::max();
+		const fixed_point_type min_value = std::numeric_limits<TestType>::min();
+		const fixed_point_type one = 1;
+
+		REQUIRE(max_value - one + one == max_value);
+		REQUIRE(min_value + one - one == min_value);
+		REQUIRE(max_value + min_value == -1);
+		REQUIRE(min_value - min_value == 0);
+		REQUIRE(-max_value - one == min_value);
+		REQUIRE_THROWS_AS(max_value + one, fixed_point_out_of_range_error);
+		REQUIRE_THROWS_AS(max_value + max_value, fixed_point_out_of_range_error);
+		REQUIRE_THROWS_AS(min_value - one, fixed_point_out_of_range_error);
+		REQUIRE_THROWS_AS(min_value + min_value, fixed_point_out_of_range_error);
+		REQUIRE_THROWS_AS(max_value - min_value, fixed_point_out_of_range_error);
+		REQUIRE_THROWS_AS(min_value - max_value - one - one, fixed_point_out_of_range_error);
+
+		auto value = max_value;
+		REQUIRE_THROWS_AS(++value, fixed_point_out_of_range_error);
+		REQUIRE(value == max_value);
+		value = min_value;
+		REQUIRE_THROWS_AS(--value, fixed_point_out_of_range_error);
+		REQUIRE(value == min_value);
+
+		using scaled_fixed_point_type = fixed_point_number<TestType, 1>;
+		const auto max_integer = std::numeric_limits<TestType>::max() / 10;
+		REQUIRE_NOTHROW(scaled_fixed_point_type(max_integer));
+		REQUIRE_NOTHROW(scaled_fixed_point_type(-max_integer));
+		REQUIRE_THROWS_AS(scaled_fixed_point_type(std::numeric_limits<TestType>::max()), fixed_point_conversion_error);
+		REQUIRE_THROWS_AS(scaled_fixed_point_type(std::numeric_limits<TestType>::min()), fixed_point_conversion_error);
+		REQUIRE_THROWS_AS(scaled_fixed_point_type(std::numeric_limits<long long>::max()), fixed_point_conversion_error);
+		REQUIRE_THROWS_AS(scaled_fixed_point_type(std::numeric_limits<unsigned long long>::max()), fixed_point_conversion_error);
+		REQUIRE(scaled_fixed_point_type(true) == 1);
+	}
+
 	TEMPLATE_LIST_TEST_CASE("Cast to integer", "", template_test_types)
 	{
 		using fixed_point_type = fixed_point_number<TestType, 1>;
@@ -1206,6 +1274,468 @@ namespace fixed_point_arithmetic
 		REQUIRE(default_round_policy::round_div<int>(-11114, 10) == -1111);
 		REQUIRE(default_round_policy::round_div<int>(-11115, 10) == -1112);
 		REQUIRE(default_round_policy::round_div<int>(-11119, 10) == -1112);
+
+		REQUIRE((default_round_policy::round_div_by_constant<int, 10>(0) == 0));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 10>(11114) == 1111));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 10>(11115) == 1112));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 10>(-11114) == -1111));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 10>(-11115) == -1112));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 1>(-11115) == -11115));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 3>(4) == 1));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 3>(5) == 2));
+		REQUIRE((default_round_policy::round_div_by_constant<int, 3>(-5) == -2));
+	}
+
+	template <typename value_t, typename divisor_t, divisor_t divisor>
+	void test_round_div_by_constant(const std::vector<value_t> & values)
+	{
+		for (const auto & value : values)
+		{
+			const auto expected = default_round_policy::round_div(value, static_cast<value_t>(divisor));
+			REQUIRE((default_round_policy::round_div_by_constant<divisor_t, divisor>(value) == expected));
+		}
+	}
+
+	template <typename value_t>
+	std::vector<value_t> generate_round_div_test_values()
+	{
+		std::vector<value_t> result;
+
+		// 64-bit products wrap around through unsigned multiplication
+		using product_t = typename std::conditional<(sizeof(value_t) > sizeof(std::int64_t)), value_t, std::uint64_t>::type;
+
+		std::uint64_t state = 1;
+		for (int i = 0; i < 1000; ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			const auto word = static_cast<std::int64_t>(state) >> (state % 64);
+			const auto value = static_cast<value_t>(product_t(word) * product_t(static_cast<std::int64_t>(state >> 32)));
+			result.push_back(value);
+			result.push_back(-value);
+		}
+
+		for (std::int64_t x = 1; x <= 1000; ++x)
+		{
+			result.push_back(static_cast<value_t>(x));
+			result.push_back(static_cast<value_t>(-x));
+			result.push_back(static_cast<value_t>(product_t(x) * product_t(5000000000000000000ll) - 1u));
+		}
+
+		return result;
+	}
+
+	template <typename value_t>
+	void test_round_div_by_scale_constants()
+	{
+		const auto values = generate_round_div_test_values<value_t>();
+		test_round_div_by_constant<value_t, std::int64_t, 1>(values);
+		test_round_div_by_constant<value_t, std::int64_t, 2>(values);
+		test_round_div_by_constant<value_t, std::int64_t, 7>(values);
+		test_round_div_by_constant<value_t, std::int64_t, 10000>(values);
+		test_round_div_by_constant<value_t, std::int64_t, 100000000>(values);
+		test_round_div_by_constant<value_t, std::int64_t, 1000000000000000000ll>(values);
+		test_round_div_by_constant<value_t, std::int64_t, std::numeric_limits<std::int64_t>::max()>(values);
+	}
+
+	TEST_CASE("Round division by constant matches round_div")
+	{
+		test_round_div_by_scale_constants<std::int64_t>();
+		test_round_div_by_scale_constants<details::int128_t>();
+		test_round_div_by_scale_constants<details::emulated_int128>();
+	}
+
+	class round_div_only_policy // custom policy without round_div_by_constant
+	{
+	public:
+		template <typename value_to_t, typename value_from_t>
+		static value_to_t round(value_from_t value)
+		{
+			return default_round_policy::round<value_to_t>(value);
+		}
+
+		template <typename value_t>
+		static value_t round_div(value_t value, value_t divisor)
+		{
+			return default_round_policy::round_div(value, divisor);
+		}
+	};
+
+	TEMPLATE_LIST_TEST_CASE("Round policy without constant division", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2, round_div_only_policy>;
+
+		const fixed_point_type a = 0.05;
+		const fixed_point_type b = 0.5;
+		const fixed_point_type c = 1.15;
+
+		REQUIRE(a * b == 0.03);
+		REQUIRE(-a * b == -0.03);
+		REQUIRE(static_cast<TestType>(c) == 1);
+		REQUIRE(static_cast<TestType>(-c) == -1);
+
+		const auto parts = (-c).get_parts();
+		REQUIRE(parts.negative);
+		REQUIRE(parts.integer == 1);
+		REQUIRE(parts.fractional == 15);
+	}
+
+	TEST_CASE("Emulated 128-bit integer")
+	{
+		using details::emulated_int128;
+
+		const auto max64 = std::numeric_limits<std::int64_t>::max();
+		const auto min64 = std::numeric_limits<std::int64_t>::min();
+
+		const auto product = emulated_int128(max64) * emulated_int128(max64);
+		REQUIRE(product / emulated_int128(max64) == emulated_int128(max64));
+		REQUIRE(product % emulated_int128(max64) == 0);
+		REQUIRE((product + 1) % emulated_int128(max64) == 1);
+		REQUIRE(product / (product + 1) == 0);
+		REQUIRE(product / product == 1);
+		REQUIRE(product > max64);
+		REQUIRE(-product < min64);
+
+		const auto min_product = emulated_int128(min64) * emulated_int128(min64);
+		REQUIRE(min_product / emulated_int128(min64) == emulated_int128(min64));
+		REQUIRE(min_product / min_product == 1);
+
+		REQUIRE(emulated_int128(-7) / emulated_int128(2) == -3);
+		REQUIRE(emulated_int128(-7) % emulated_int128(2) == -1);
+		REQUIRE(emulated_int128(7) / emulated_int128(-2) == -3);
+		REQUIRE(emulated_int128(7) % emulated_int128(-2) == 1);
+		REQUIRE(static_cast<std::int64_t>(emulated_int128(min64)) == min64);
+		REQUIRE(static_cast<std::int64_t>(-emulated_int128(max64)) == -max64);
+
+		const std::int64_t samples[] = { 0, 1, -1, 3, -7, 10, 99999999, -100000000, 5000000000000ll, -123456789012345ll, max64, min64 + 1, min64 };
+		for (const auto a : samples)
+		{
+			for (const auto b : samples)
+			{
+				if (b == 0)
+					continue;
+
+				const auto wide = emulated_int128(a) * emulated_int128(b);
+				REQUIRE(wide / emulated_int128(b) == a);
+				REQUIRE(wide % emulated_int128(b) == 0);
+				REQUIRE(default_round_policy::round_div(wide, emulated_int128(b)) == a);
+
+				const auto shifted = wide + 12345;
+				REQUIRE((shifted / emulated_int128(b)) * emulated_int128(b) + shifted % emulated_int128(b) == shifted);
+			}
+
+			const auto half_up = emulated_int128(a) * 10 + 5;
+			REQUIRE(default_round_policy::round_div(half_up, emulated_int128(10)) == emulated_int128(a) + (a >= 0 ? 1 : 0));
+			REQUIRE(default_round_policy::round_div(half_up - 1, emulated_int128(10)) == a);
+		}
+
+#if defined(FIXED_POINT_NUMBER_HAS_INT128)
+		const auto to_emulated = [](details::int128_t value)
+		{
+			const auto shift = emulated_int128(std::int64_t(1) << 32);
+			return emulated_int128(static_cast<std::int64_t>(value >> 64)) * shift * shift + emulated_int128(static_cast<std::uint64_t>(value));
+		};
+
+		std::uint64_t state = 1;
+		const auto next_random = [&state]()
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			return static_cast<std::int64_t>(state) >> (state % 64);
+		};
+
+		for (int i = 0; i < 10000; ++i)
+		{
+			const auto a = next_random();
+			const auto b = next_random();
+			const auto c = next_random();
+			if (c == 0)
+				continue;
+
+			const auto native = static_cast<details::int128_t>(a) * b;
+			const auto emulated = emulated_int128(a) * emulated_int128(b);
+			REQUIRE(emulated == to_emulated(native));
+			REQUIRE(emulated / emulated_int128(c) == to_emulated(native / c));
+			REQUIRE(emulated % emulated_int128(c) == to_emulated(native % c));
+			REQUIRE(emulated / (emulated_int128(c) * c + 1) == to_emulated(native / (static_cast<details::int128_t>(c) * c + 1)));
+		}
+#endif
+	}
+
+	TEST_CASE("Multiply divide of 64-bit storage without intermediate overflow")
+	{
+		using fixed_point_type = fixed_point_number<std::int64_t, 8>;
+
+		const fixed_point_type a = 50000;
+		const fixed_point_type b = 3;
+
+		REQUIRE(a * b == 150000);
+		REQUIRE(b * a == 150000);
+		REQUIRE(-a * b == -150000);
+		REQUIRE((a * b) / b == a);
+		REQUIRE((a * b) / a == b);
+		REQUIRE(a / b == 16666.66666667);
+		REQUIRE(-a / b == -16666.66666667);
+
+		const fixed_point_type big = std::numeric_limits<std::int64_t>::max() / fixed_point_type::scale_value;
+		const fixed_point_type half = 0.5;
+		REQUIRE(big * half * 2 == big);
+		REQUIRE(big / big == 1);
+		REQUIRE_THROWS_AS(big * 2 * 2, fixed_point_out_of_range_error);
+		REQUIRE_THROWS_AS(big / half / half, fixed_point_out_of_range_error);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Non-throwing arithmetic", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 1>;
+
+		const fixed_point_type a = 1.5;
+		const fixed_point_type b = 0.5;
+		const fixed_point_type max_value = std::numeric_limits<TestType>::max() / fixed_point_type::scale_value;
+		const fixed_point_type min_value = -max_value;
+
+		const auto sum = try_add(a, b);
+		REQUIRE(sum.has_value());
+		REQUIRE(static_cast<bool>(sum));
+		REQUIRE(sum.status() == fixed_point_status::ok);
+		REQUIRE(sum.value() == 2);
+
+		REQUIRE(try_sub(a, b).value() == 1);
+		REQUIRE(try_mul(a, b).value() == 0.8);
+		REQUIRE(try_div(a, b).value() == 3);
+
+		REQUIRE(try_add(max_value, max_value).status() == fixed_point_status::out_of_range);
+		REQUIRE(try_sub(min_value, max_value).status() == fixed_point_status::out_of_range);
+		REQUIRE(try_mul(max_value, a).status() == fixed_point_status::out_of_range);
+		REQUIRE(try_div(max_value, b).status() == fixed_point_status::out_of_range);
+		REQUIRE(try_div(a, 0).status() == fixed_point_status::division_by_zero);
+		REQUIRE_FALSE(try_div(a, 0));
+		REQUIRE(try_div(a, 0).value_or(b) == b);
+
+		REQUIRE_THROWS_AS(max_value + max_value, fixed_point_out_of_range_error);
+		REQUIRE_THROWS_AS(a / 0, std::invalid_argument);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Overflow policies", "", template_test_types)
+	{
+		const auto max_integer = std::numeric_limits<TestType>::max() / 10;
+
+		SECTION("saturate")
+		{
+			using fixed_point_type = fixed_point_number<TestType, 1, default_round_policy, saturate_overflow_policy>;
+			const fixed_point_type m = max_integer;
+			const auto max_value = m + m;
+			const auto min_value = -m - m - m;
+
+			REQUIRE(max_value > m);
+			REQUIRE(max_value + m == max_value);
+			REQUIRE(++fixed_point_type(max_value) == max_value);
+			REQUIRE(min_value < -m);
+			REQUIRE(min_value - m == min_value);
+			REQUIRE(--fixed_point_type(min_value) == min_value);
+			REQUIRE(-min_value == max_value);
+			REQUIRE(m * 2 == max_value);
+			REQUIRE(m * -2 == min_value);
+			REQUIRE(m / fixed_point_type(0.5) == max_value);
+			REQUIRE(m - 1 == max_integer - 1);
+			REQUIRE_THROWS_AS(m / 0, std::invalid_argument);
+			REQUIRE_THROWS_AS(fixed_point_type(static_cast<long long>(max_integer) * 2), fixed_point_conversion_error);
+		}
+
+		SECTION("wrap")
+		{
+			using fixed_point_type = fixed_point_number<TestType, 1, default_round_policy, wrap_overflow_policy>;
+			const fixed_point_type m = max_integer;
+			const auto wrapped = m + m;
+
+			REQUIRE(wrapped < 0);
+			REQUIRE(wrapped - m == m);
+			REQUIRE(m * 2 == wrapped);
+			REQUIRE(-(-m - m) == wrapped);
+			REQUIRE_THROWS_AS(m / 0, std::invalid_argument);
+		}
+
+		SECTION("unchecked")
+		{
+			using fixed_point_type = fixed_point_number<TestType, 1, default_round_policy, unchecked_overflow_policy>;
+			const fixed_point_type m = max_integer;
+
+			REQUIRE(m - 1 + 1 == m);
+			REQUIRE(-m + m == 0);
+			REQUIRE(fixed_point_type(1.5) * fixed_point_type(0.5) == 0.8);
+			REQUIRE(fixed_point_type(1.5) / fixed_point_type(0.5) == 3);
+		}
+
+		SECTION("throw")
+		{
+			using fixed_point_type = fixed_point_number<TestType, 1, default_round_policy, throw_overflow_policy>;
+			static_assert(std::is_same<fixed_point_type, fixed_point_number<TestType, 1>>::value, "Throwing overflow policy must be the default one.");
+			const fixed_point_type m = max_integer;
+
+			REQUIRE_THROWS_AS(m + m, fixed_point_out_of_range_error);
+			REQUIRE_THROWS_AS(-m - m - m, fixed_point_out_of_range_error);
+			REQUIRE_THROWS_AS(m * 2, fixed_point_out_of_range_error);
+		}
+	}
+
+	TEST_CASE("Constant expressions")
+	{
+		using fixed_point_type = fixed_point_number<long long, 6>;
+
+		constexpr fixed_point_type tick_size = fixed_point_type(1) / 100;
+		constexpr auto fee_rate = fixed_point_type(25) / 10000;
+		constexpr auto notional = fixed_point_type(1250) * 3;
+		constexpr auto fee = notional * fee_rate;
+
+		static_assert(fee_rate == fixed_point_type(1) / 400, "Division must be a constant expression.");
+		static_assert(fee == fixed_point_type(9375) / 1000, "Multiplication must be a constant expression.");
+		static_assert(fee + tick_size - fee == tick_size, "Addition and subtraction must be constant expressions.");
+		static_assert(-fee < 0 && +fee > 0 && fee != notional && fee <= fee && fee >= fee, "Comparison must be a constant expression.");
+		static_assert(static_cast<int>(fee) == 9 && static_cast<long long>(-fee) == -9, "Conversion to integer must be a constant expression.");
+		static_assert(fee.get_parts().integer == 9 && fee.get_parts().fractional == 375000 && !fee.get_parts().negative, "get_parts must be a constant expression.");
+
+		static_assert(try_add(fee, tick_size).value() == fixed_point_type(9385) / 1000, "try_add must be a constant expression.");
+		static_assert(try_sub(fee, tick_size).has_value(), "try_sub must be a constant expression.");
+		static_assert(try_mul(fee, 2).value() == fixed_point_type(1875) / 100, "try_mul must be a constant expression.");
+		static_assert(try_div(fee, 0).status() == fixed_point_status::division_by_zero, "try_div must be a constant expression.");
+		static_assert(try_convert<fixed_point_type>(std::numeric_limits<long long>::max()).status() == fixed_point_status::conversion_error, "try_convert must be a constant expression.");
+		static_assert(try_convert<int>(fee).value() == 9, "try_convert must be a constant expression.");
+
+		constexpr auto incremented = []()
+		{
+			const auto step = fixed_point_type(1) / 100;
+			fixed_point_type value = 1;
+			++value;
+			value++;
+			--value;
+			value -= step;
+			value += step;
+			value *= 2;
+			value /= 4;
+			return value;
+		}();
+		static_assert(incremented == 1, "Assignment operators must be constant expressions.");
+
+		using small_fixed_point_type = fixed_point_number<std::int8_t, 1, default_round_policy, saturate_overflow_policy>;
+		static_assert((small_fixed_point_type(12) + small_fixed_point_type(12)).get_parts().fractional == 7, "Overflow policies must be constant expressions.");
+		static_assert(fixed_point_number<std::int16_t, 2>(3) / 7 == fixed_point_number<std::int16_t, 2>(43) / 100, "Rounding must be a constant expression.");
+
+		static_assert(details::emulated_int128(-3) * 5 / 2 == -7, "Emulated 128-bit arithmetic must be a constant expression.");
+		static_assert(default_round_policy::round_div_by_constant<long long, 1000>(details::emulated_int128(-1500)) == -2, "Emulated 128-bit rounding must be a constant expression.");
+
+		REQUIRE(fee == 9.375);
+	}
+
+	TEST_CASE("Decimal literals")
+	{
+		using namespace literals;
+		using fixed_point_type = fixed_point_number<long long, 6>;
+
+		constexpr fixed_point_type price = 12.345_fp;
+		static_assert(price.raw_value() == 12345000, "Literal must be converted at compile time.");
+		static_assert(price == fixed_point_type(12345) / 1000, "Literal must be equal to the exact decimal value.");
+
+		constexpr fixed_point_type negative = -0.000001_fp;
+		static_assert(negative.raw_value() == -1, "Negative literal must be converted at compile time.");
+		static_assert(fixed_point_type(-(-1.5_fp)).raw_value() == 1500000, "Double negation must give the original value.");
+		static_assert(fixed_point_type(42_fp).raw_value() == 42000000, "Integer literal must be supported.");
+		static_assert(fixed_point_type(1'000.25_fp).raw_value() == 1000250000, "Digit separators must be ignored.");
+		static_assert(fixed_point_type(0.1000000_fp).raw_value() == 100000, "Trailing zeros of fraction must be accepted.");
+		static_assert(fixed_point_type(7._fp).raw_value() == 7000000, "Literal may end with point.");
+
+		static_assert(fixed_point_number<std::int8_t, 1>(12.7_fp).raw_value() == 127, "Maximum value must be accepted.");
+		static_assert(fixed_point_number<std::int8_t, 1>(-12.8_fp).raw_value() == -128, "Minimum value must be accepted.");
+		static_assert(fixed_point_number<std::int64_t, 0>(-9223372036854775808_fp).raw_value() == std::numeric_limits<std::int64_t>::min(),
+			"Minimum value must be accepted.");
+
+		using details::decimal_literal_error;
+		using details::parse_decimal_literal;
+		static_assert(parse_decimal_literal<std::int8_t, 1, false, '1', '2', '.', '8'>().error == decimal_literal_error::out_of_range, "Literal above maximum must be rejected.");
+		static_assert(parse_decimal_literal<std::int8_t, 1, true, '1', '2', '.', '9'>().error == decimal_literal_error::out_of_range, "Literal below minimum must be rejected.");
+		static_assert(parse_decimal_literal<std::int8_t, 1, false, '2', '0', '0'>().error == decimal_literal_error::out_of_range, "Scaled literal above maximum must be rejected.");
+		static_assert(parse_decimal_literal<std::int32_t, 2, false, '1', '.', '2', '3', '4'>().error == decimal_literal_error::too_many_fraction_digits,
+			"Literal with excess fraction digits must be rejected.");
+		static_assert(parse_decimal_literal<std::int32_t, 2, false, '1', 'e', '3'>().error == decimal_literal_error::invalid_character, "Exponent must be rejected.");
+		static_assert(parse_decimal_literal<std::int32_t, 2, false, '0', 'x', '1'>().error == decimal_literal_error::invalid_character, "Hexadecimal literal must be rejected.");
+
+		REQUIRE(price == 12.345);
+		REQUIRE(price + 0.005_fp == 12.35_fp);
+		REQUIRE(price * 2_fp == 24.69);
+		REQUIRE(price > 12.3449_fp);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Layout compatibility with storage type", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+
+		static_assert(std::is_trivially_copyable<fixed_point_type>::value, "Fixed point number must be trivially copyable.");
+		static_assert(std::is_standard_layout<fixed_point_type>::value, "Fixed point number must be a standard layout type.");
+		static_assert(sizeof(fixed_point_type) == sizeof(TestType), "Fixed point number must have the same size as its storage type.");
+
+		const fixed_point_type value = -1.25;
+		fixed_point_type copy;
+		std::memcpy(&copy, &value, sizeof(value));
+		REQUIRE(copy == value);
+
+		std::vector<fixed_point_type> values = { 1.25, -0.5, 0 };
+		const auto raw_values = as_raw_span(values);
+		static_assert(std::is_same<decltype(raw_values), const span<TestType>>::value, "Raw view of mutable numbers must be mutable.");
+		REQUIRE(raw_values.size() == values.size());
+		REQUIRE(raw_values[0] == 125);
+		REQUIRE(raw_values[1] == -50);
+		REQUIRE(raw_values[2] == 0);
+
+		raw_values[2] = 1;
+		REQUIRE(values[2] == 0.01);
+
+		const std::vector<TestType> loaded = { 100, -1, 12 };
+		const auto numbers = from_raw_span<fixed_point_type>(loaded);
+		static_assert(std::is_same<decltype(numbers), const span<const fixed_point_type>>::value, "View of constant raw values must be constant.");
+		REQUIRE(numbers.size() == loaded.size());
+		REQUIRE(numbers[0] == 1);
+		REQUIRE(numbers[1] == -0.01);
+		REQUIRE(numbers[2] == 0.12);
+		REQUIRE(std::vector<fixed_point_type>(numbers.begin(), numbers.end()) == std::vector<fixed_point_type>{ 1, -0.01, 0.12 });
+
+		const span<const fixed_point_type> numbers_view = values;
+		REQUIRE(as_raw_span(numbers_view)[0] == 125);
+		REQUIRE(from_raw_span<fixed_point_type>(raw_values).data() == values.data());
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Non-throwing conversion", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 1>;
+		const auto max_integer = std::numeric_limits<TestType>::max() / fixed_point_type::scale_value;
+
+		REQUIRE(try_convert<fixed_point_type>(max_integer).value() == max_integer);
+		REQUIRE(try_convert<fixed_point_type>(-1.25).value() == -1.3);
+		REQUIRE(try_convert<fixed_point_type>(static_cast<long long>(max_integer) + 1).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_type>(1e30).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_type>(std::numeric_limits<double>::quiet_NaN()).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_type>(std::numeric_limits<double>::infinity()).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_type>(-std::numeric_limits<float>::infinity()).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_type>(std::numeric_limits<long double>::max()).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_type>(std::numeric_limits<double>::denorm_min()).value() == 0);
+		REQUIRE_THROWS_AS(fixed_point_type(1e30), fixed_point_conversion_error);
+
+		const fixed_point_type value = 2.5;
+		REQUIRE(try_convert<int>(value).value() == 3);
+		REQUIRE(try_convert<double>(value).value() == 2.5);
+		REQUIRE(try_convert<std::int8_t>(fixed_point_type(-max_integer)).has_value() == (max_integer <= 128));
+	}
+
+	TEST_CASE("Floating point environment is preserved")
+	{
+		using fixed_point_type = fixed_point_number<std::int32_t, 2>;
+
+		// flags raised by the caller survive conversions
+		std::feraiseexcept(FE_OVERFLOW | FE_UNDERFLOW);
+		REQUIRE(try_convert<fixed_point_type>(1.25).value() == 1.25);
+		REQUIRE(try_convert<fixed_point_type>(1e30).status() == fixed_point_status::conversion_error);
+		REQUIRE(static_cast<double>(fixed_point_type(-0.01)) == -0.01);
+		REQUIRE(std::fetestexcept(FE_OVERFLOW | FE_UNDERFLOW) == (FE_OVERFLOW | FE_UNDERFLOW));
+
+		std::feclearexcept(FE_ALL_EXCEPT);
+		REQUIRE(static_cast<float>(fixed_point_type(0.01)) == 0.01f);
+		REQUIRE(std::fetestexcept(FE_OVERFLOW | FE_UNDERFLOW) == 0);
 	}
 
 	TEST_CASE("Construct")
@@ -1356,5 +1886,793 @@ namespace fixed_point_arithmetic
 			REQUIRE(fixed_point_arithmetic::to_string(a) == "-1234.0070");
 			REQUIRE((fixed_point_arithmetic::to_wstring(a) == L"-1234.0070"));
 		}
+
+		{
+			fixed_point_number<std::int32_t, 0> a = -1234;
+			REQUIRE(fixed_point_arithmetic::to_string(a) == "-1234.0");
+			REQUIRE((fixed_point_arithmetic::to_wstring(a) == L"-1234.0"));
+		}
+	}
+
+	class truncate_round_policy // custom policy rounding towards zero
+	{
+	public:
+		template <typename value_to_t, typename value_from_t>
+		static value_to_t round(value_from_t value)
+		{
+			return static_cast<value_to_t>(std::trunc(value));
+		}
+
+		template <typename value_t>
+		static value_t round_div(value_t value, value_t divisor)
+		{
+			return value / divisor;
+		}
+	};
+
+	template <typename fixed_point_t>
+	void test_from_chars(const std::string & text, const fixed_point_t & expected, std::size_t parsed_length)
+	{
+		fixed_point_t value = 1;
+		const auto result = from_chars(text.data(), text.data() + text.size(), value);
+		REQUIRE(result.ec == std::errc());
+		REQUIRE(result.ptr == text.data() + parsed_length);
+		REQUIRE(value == expected);
+	}
+
+	template <typename fixed_point_t>
+	void test_from_chars(const std::string & text, const fixed_point_t & expected)
+	{
+		test_from_chars(text, expected, text.size());
+	}
+
+	template <typename fixed_point_t>
+	void test_from_chars_error(const std::string & text, std::errc expected_error, std::size_t parsed_length)
+	{
+		const fixed_point_t initial_value = 1;
+		auto value = initial_value;
+		const auto result = from_chars(text.data(), text.data() + text.size(), value);
+		REQUIRE(result.ec == expected_error);
+		REQUIRE(result.ptr == text.data() + parsed_length);
+		REQUIRE(value == initial_value);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Parse from chars", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+
+		test_from_chars("0", fixed_point_type(0));
+		test_from_chars("-0", fixed_point_type(0));
+		test_from_chars("1", fixed_point_type(1));
+		test_from_chars("-1.2", fixed_point_type(-1.2));
+		test_from_chars("0.05", fixed_point_type(0.05));
+		test_from_chars("-.05", fixed_point_type(-0.05));
+		test_from_chars("1.", fixed_point_type(1));
+		test_from_chars("0001.10", fixed_point_type(1.1));
+		test_from_chars("1.1x", fixed_point_type(1.1), 3);
+		test_from_chars("1.-1", fixed_point_type(1), 2);
+		test_from_chars("1 ", fixed_point_type(1), 1);
+
+		// excess fraction digits are rounded half away from zero by default policy
+		test_from_chars("0.004", fixed_point_type(0));
+		test_from_chars("0.005", fixed_point_type(0.01));
+		test_from_chars("-0.005", fixed_point_type(-0.01));
+		test_from_chars("1.0049999", fixed_point_type(1));
+		test_from_chars("1.0050000", fixed_point_type(1.01));
+		test_from_chars("-1.0049999", fixed_point_type(-1));
+		test_from_chars("1.2099", fixed_point_type(1.21));
+		test_from_chars("0.99999", fixed_point_type(1));
+
+		test_from_chars_error<fixed_point_type>("", std::errc::invalid_argument, 0);
+		test_from_chars_error<fixed_point_type>("-", std::errc::invalid_argument, 0);
+		test_from_chars_error<fixed_point_type>(".", std::errc::invalid_argument, 0);
+		test_from_chars_error<fixed_point_type>("-.", std::errc::invalid_argument, 0);
+		test_from_chars_error<fixed_point_type>("+1", std::errc::invalid_argument, 0);
+		test_from_chars_error<fixed_point_type>(" 1", std::errc::invalid_argument, 0);
+		test_from_chars_error<fixed_point_type>("1000000000000000000000", std::errc::result_out_of_range, 22);
+		test_from_chars_error<fixed_point_type>("-1000000000000000000000.5x", std::errc::result_out_of_range, 25);
+
+		// limits of storage type
+		const auto min_value = fixed_point_type::from_raw_value(std::numeric_limits<TestType>::min());
+		const auto max_value = fixed_point_type::from_raw_value(std::numeric_limits<TestType>::max());
+		test_from_chars(to_string(min_value), min_value);
+		test_from_chars(to_string(max_value), max_value);
+		test_from_chars(to_string(max_value) + "4999", max_value);
+		test_from_chars_error<fixed_point_type>(to_string(max_value) + "5", std::errc::result_out_of_range, to_string(max_value).size() + 1);
+		test_from_chars_error<fixed_point_type>(to_string(min_value) + "5", std::errc::result_out_of_range, to_string(min_value).size() + 1);
+
+		using truncating_fixed_point_type = fixed_point_number<TestType, 2, truncate_round_policy>;
+		test_from_chars("1.2399", truncating_fixed_point_type::from_raw_value(123));
+		test_from_chars("-1.2399", truncating_fixed_point_type::from_raw_value(-123));
+		test_from_chars(to_string(max_value) + "9", truncating_fixed_point_type::from_raw_value(std::numeric_limits<TestType>::max()));
+
+		using integer_fixed_point_type = fixed_point_number<TestType, 0>;
+		test_from_chars("12.5", integer_fixed_point_type(13));
+		test_from_chars("-12.4", integer_fixed_point_type(-12));
+		test_from_chars("12.0", integer_fixed_point_type(12));
+
+		REQUIRE(from_string<fixed_point_type>("-1.25") == -1.25);
+		REQUIRE_THROWS_AS(from_string<fixed_point_type>("1.25 "), std::invalid_argument);
+		REQUIRE_THROWS_AS(from_string<fixed_point_type>("abc"), std::invalid_argument);
+		REQUIRE_THROWS_AS(from_string<fixed_point_type>("1000000000000000000000"), fixed_point_conversion_error);
+	}
+
+	TEST_CASE("Parse long digit runs")
+	{
+		using fixed_point_type = fixed_point_number<std::int64_t, 8>;
+
+		test_from_chars("12345678.87654321", fixed_point_type::from_raw_value(1234567887654321));
+		test_from_chars("-12345678.87654321", fixed_point_type::from_raw_value(-1234567887654321));
+		test_from_chars("0.12345678", fixed_point_type::from_raw_value(12345678));
+		test_from_chars("0.123456789", fixed_point_type::from_raw_value(12345679));
+		test_from_chars("0.1234567849999999999", fixed_point_type::from_raw_value(12345678));
+		test_from_chars("00000000000000000000000000000000012.5", fixed_point_type(12.5));
+		test_from_chars("-0000000000000000000000000000000000.00000001", fixed_point_type::from_raw_value(-1));
+		test_from_chars("92233720368.54775807", fixed_point_type::from_raw_value(std::numeric_limits<std::int64_t>::max()));
+		test_from_chars("-92233720368.54775808", fixed_point_type::from_raw_value(std::numeric_limits<std::int64_t>::min()));
+		test_from_chars_error<fixed_point_type>("92233720368.54775808", std::errc::result_out_of_range, 20);
+		test_from_chars_error<fixed_point_type>("-92233720368.54775809", std::errc::result_out_of_range, 21);
+		test_from_chars_error<fixed_point_type>("123456789012345678901234567890", std::errc::result_out_of_range, 30);
+
+		// characters next to digits in the ASCII table end digit runs
+		test_from_chars("1234567/89", fixed_point_type(1234567), 7);
+		test_from_chars("1234567:89", fixed_point_type(1234567), 7);
+		test_from_chars("0.1234567/", fixed_point_type::from_raw_value(12345670), 9);
+		test_from_chars("0.1234567a", fixed_point_type::from_raw_value(12345670), 9);
+
+		using integer_fixed_point_type = fixed_point_number<std::int64_t, 0>;
+
+		test_from_chars("1234567890123456", integer_fixed_point_type::from_raw_value(1234567890123456));
+		test_from_chars("9223372036854775807", integer_fixed_point_type::from_raw_value(std::numeric_limits<std::int64_t>::max()));
+		test_from_chars("-9223372036854775808", integer_fixed_point_type::from_raw_value(std::numeric_limits<std::int64_t>::min()));
+		test_from_chars("000000000000000009223372036854775807", integer_fixed_point_type::from_raw_value(std::numeric_limits<std::int64_t>::max()));
+		test_from_chars_error<integer_fixed_point_type>("9223372036854775808", std::errc::result_out_of_range, 19);
+		test_from_chars_error<integer_fixed_point_type>("99999999999999999999", std::errc::result_out_of_range, 20);
+
+		// every position of a wrong character inside of 16 digits
+		for (std::size_t i = 1; i < 16; ++i)
+		{
+			std::string text = "1234567890123456";
+			text[i] = (i % 2 == 0) ? '/' : ':';
+			test_from_chars(text + "7", integer_fixed_point_type::from_raw_value(std::stoll(text.substr(0, i))), i);
+		}
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Parse formatted values back", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 1>;
+
+		std::uint64_t state = 7;
+		for (int i = 0; i < 10000; ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			const auto value = fixed_point_type::from_raw_value(static_cast<TestType>(state >> (64 - 8 * sizeof(TestType))));
+
+			fixed_point_type parsed;
+			const auto text = to_string(value);
+			const auto result = from_chars(text.data(), text.data() + text.size(), parsed);
+			REQUIRE(result.ec == std::errc());
+			REQUIRE(parsed == value);
+		}
+	}
+
+	template <typename fixed_point_t>
+	void test_all_values_to_floating_point()
+	{
+		using value_t = typename fixed_point_t::value_type;
+
+		// strtod and strtof round exact decimal representation correctly
+		for (int raw_value = std::numeric_limits<value_t>::min(); raw_value <= std::numeric_limits<value_t>::max(); ++raw_value)
+		{
+			const auto value = fixed_point_t::from_raw_value(static_cast<value_t>(raw_value));
+			const auto text = to_string(value);
+			REQUIRE(static_cast<double>(value) == std::strtod(text.c_str(), nullptr));
+			REQUIRE(static_cast<float>(value) == std::strtof(text.c_str(), nullptr));
+		}
+	}
+
+	// value * scale rounded with exact decimal expansion of value, half_away_from_zero selects default policy over truncation
+	long long exactly_rounded_scaled_value(double value, unsigned int fraction_digits_num, bool half_away_from_zero)
+	{
+		char text[128];
+		std::snprintf(text, sizeof(text), "%.80f", std::fabs(value)); // expansion of values used below ends before 80 digits
+
+		std::string digits(text);
+		const auto point = digits.find('.');
+		const auto integer_part = digits.substr(0, point) + digits.substr(point + 1, fraction_digits_num);
+		const auto rest = digits.substr(point + 1 + fraction_digits_num);
+
+		auto magnitude = std::stoll(integer_part);
+		if (half_away_from_zero && rest[0] >= '5')
+			++magnitude;
+
+		return (value < 0) ? -magnitude : magnitude;
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num, typename round_policy_t, typename source_t>
+	void test_conversion_near_boundary(source_t boundary)
+	{
+		using fixed_point_type = fixed_point_number<value_t, fraction_digits_num, round_policy_t>;
+		constexpr bool half_away_from_zero = std::is_same<round_policy_t, default_round_policy>::value;
+
+		const source_t sources[] =
+		{
+			std::nextafter(boundary, -std::numeric_limits<source_t>::infinity()),
+			boundary,
+			std::nextafter(boundary, std::numeric_limits<source_t>::infinity())
+		};
+
+		for (const auto source : sources)
+		{
+			const auto expected = exactly_rounded_scaled_value(source, fraction_digits_num, half_away_from_zero);
+
+			// values next to the limits are rounded before the range check too
+			const auto result = try_convert<fixed_point_type>(source);
+			if (expected < std::numeric_limits<value_t>::min() || expected > std::numeric_limits<value_t>::max())
+			{
+				REQUIRE(result.status() == fixed_point_status::conversion_error);
+			}
+			else
+			{
+				REQUIRE(result.value().raw_value() == expected);
+			}
+		}
+	}
+
+	template <typename value_t, unsigned int fraction_digits_num, typename source_t>
+	void test_all_boundaries_from_floating_point()
+	{
+		using fixed_point_type = fixed_point_number<value_t, fraction_digits_num>;
+
+		// the nearest floating point numbers to every half and integer of scaled value and their neighbours
+		for (int raw_value = std::numeric_limits<value_t>::min(); raw_value <= std::numeric_limits<value_t>::max(); ++raw_value)
+		{
+			const auto text = to_string(fixed_point_type::from_raw_value(static_cast<value_t>(raw_value)));
+			const auto half_text = (fraction_digits_num > 0) ? text + "5" : text.substr(0, text.size() - 1) + "5";
+
+			const auto parse = [](const std::string & number) { return static_cast<source_t>(std::strtold(number.c_str(), nullptr)); };
+			test_conversion_near_boundary<value_t, fraction_digits_num, default_round_policy>(parse(half_text));
+			test_conversion_near_boundary<value_t, fraction_digits_num, truncate_round_policy>(parse(text));
+		}
+	}
+
+	template <typename source_t>
+	void test_conversion_rounded_into_range()
+	{
+		// scaled values between a limit of the storage type and the integer next to it are rounded to the limit
+		REQUIRE(fixed_point_number<std::int8_t, 2>(static_cast<source_t>(-1.284L)).raw_value() == -128);
+		REQUIRE(fixed_point_number<std::int8_t, 2>(static_cast<source_t>(1.274L)).raw_value() == 127);
+		REQUIRE(fixed_point_number<std::int8_t, 2, truncate_round_policy>(static_cast<source_t>(1.279L)).raw_value() == 127);
+		REQUIRE(fixed_point_number<std::int16_t, 0>(static_cast<source_t>(32767.3L)).raw_value() == 32767);
+		REQUIRE(try_convert<fixed_point_number<std::int16_t, 0>>(static_cast<source_t>(-32768.4L)).value().raw_value() == -32768);
+
+		// or beyond it
+		REQUIRE(try_convert<fixed_point_number<std::int8_t, 2>>(static_cast<source_t>(1.276L)).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_number<std::int8_t, 2>>(static_cast<source_t>(-1.286L)).status() == fixed_point_status::conversion_error);
+		REQUIRE(try_convert<fixed_point_number<std::int8_t, 2, truncate_round_policy>>(static_cast<source_t>(1.281L)).status() == fixed_point_status::conversion_error);
+		REQUIRE_THROWS_AS((fixed_point_number<std::int16_t, 0>(static_cast<source_t>(32767.6L))), fixed_point_conversion_error);
+	}
+
+	TEST_CASE("Conversion of floating point numbers rounded into range")
+	{
+		test_conversion_rounded_into_range<float>();
+		test_conversion_rounded_into_range<double>();
+		test_conversion_rounded_into_range<long double>();
+
+		REQUIRE(fixed_point_number<std::int32_t, 4>(-214748.36484).raw_value() == std::numeric_limits<std::int32_t>::min());
+		REQUIRE(try_convert<fixed_point_number<std::int32_t, 4>>(214748.36476).status() == fixed_point_status::conversion_error);
+
+		REQUIRE(fixed_point_number<std::int32_t, 4>(-214748.36484L).raw_value() == std::numeric_limits<std::int32_t>::min());
+		REQUIRE(try_convert<fixed_point_number<std::int32_t, 4>>(214748.36476L).status() == fixed_point_status::conversion_error);
+
+		if constexpr (std::numeric_limits<long double>::digits >= 64)
+		{
+			// halves are representable right below 2^63
+			constexpr auto below_limit = 9223372036854775807.5L;
+			REQUIRE(fixed_point_number<std::int64_t, 0, truncate_round_policy>(below_limit).raw_value() == std::numeric_limits<std::int64_t>::max());
+			REQUIRE(try_convert<fixed_point_number<std::int64_t, 0>>(below_limit).status() == fixed_point_status::conversion_error);
+		}
+	}
+
+	TEST_CASE("Exact conversion of floating point numbers")
+	{
+		test_all_values_to_floating_point<fixed_point_number<std::int8_t, 0>>();
+		test_all_values_to_floating_point<fixed_point_number<std::int8_t, 2>>();
+		test_all_values_to_floating_point<fixed_point_number<std::int16_t, 1>>();
+		test_all_values_to_floating_point<fixed_point_number<std::int16_t, 4>>();
+
+		test_all_boundaries_from_floating_point<std::int8_t, 0, double>();
+		test_all_boundaries_from_floating_point<std::int8_t, 2, double>();
+		test_all_boundaries_from_floating_point<std::int8_t, 2, float>();
+		test_all_boundaries_from_floating_point<std::int16_t, 1, double>();
+		test_all_boundaries_from_floating_point<std::int16_t, 4, double>();
+		test_all_boundaries_from_floating_point<std::int16_t, 3, float>();
+	}
+
+	template <typename fixed_point_t>
+	void test_to_chars(const fixed_point_t & value, const std::string & expected)
+	{
+		char buffer[fixed_point_t::max_chars_num + 1] = {};
+
+		const auto result = to_chars(buffer, buffer + fixed_point_t::max_chars_num, value);
+		REQUIRE(result.ec == std::errc());
+		REQUIRE(std::string(buffer, result.ptr) == expected);
+		REQUIRE(buffer[fixed_point_t::max_chars_num] == 0);
+
+		const auto length = static_cast<std::size_t>(result.ptr - buffer);
+		const auto exact_result = to_chars(buffer, buffer + length, value);
+		REQUIRE(exact_result.ec == std::errc());
+		REQUIRE(exact_result.ptr == buffer + length);
+
+		for (std::size_t size = 0; size < length; ++size)
+		{
+			const auto short_result = to_chars(buffer, buffer + size, value);
+			REQUIRE(short_result.ec == std::errc::value_too_large);
+			REQUIRE(short_result.ptr == buffer + size);
+		}
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Convert to chars", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+		using integer_fixed_point_type = fixed_point_number<TestType, 0>;
+
+		const auto min_value = fixed_point_type::from_raw_value(std::numeric_limits<TestType>::min());
+		const auto max_value = fixed_point_type::from_raw_value(std::numeric_limits<TestType>::max());
+		const auto min_integer = integer_fixed_point_type::from_raw_value(std::numeric_limits<TestType>::min());
+
+		test_to_chars(fixed_point_type(0), "0.00");
+		test_to_chars(fixed_point_type(-0.01), "-0.01");
+		test_to_chars(fixed_point_type(1.1), "1.10");
+		test_to_chars(min_value, to_string(min_value));
+		test_to_chars(max_value, to_string(max_value));
+		test_to_chars(integer_fixed_point_type(-5), "-5.0");
+
+		REQUIRE(to_string(min_value).size() == fixed_point_type::max_chars_num);
+		REQUIRE(to_string(min_integer).size() == integer_fixed_point_type::max_chars_num);
+		REQUIRE(to_string(min_integer) == std::to_string(std::numeric_limits<TestType>::min()) + ".0");
+	}
+
+	template <unsigned int fraction_digits_num>
+	void test_all_int16_values_to_chars()
+	{
+		using fixed_point_type = fixed_point_number<std::int16_t, fraction_digits_num>;
+		const int scale = static_cast<int>(fixed_point_type::scale_value);
+
+		for (int raw_value = std::numeric_limits<std::int16_t>::min(); raw_value <= std::numeric_limits<std::int16_t>::max(); ++raw_value)
+		{
+			const auto magnitude = std::abs(raw_value);
+			const auto fractional = std::to_string(magnitude % scale);
+			const auto expected = std::string(raw_value < 0 ? "-" : "") + std::to_string(magnitude / scale) + '.' +
+				((fraction_digits_num > 0) ? std::string(fraction_digits_num - fractional.size(), '0') + fractional : std::string("0"));
+
+			REQUIRE(to_string(fixed_point_type::from_raw_value(static_cast<std::int16_t>(raw_value))) == expected);
+		}
+	}
+
+	TEST_CASE("Convert all values to chars")
+	{
+		test_all_int16_values_to_chars<0>();
+		test_all_int16_values_to_chars<1>();
+		test_all_int16_values_to_chars<2>();
+		test_all_int16_values_to_chars<3>();
+		test_all_int16_values_to_chars<4>();
+	}
+
+	template <typename fixed_point_t>
+	std::vector<double> generate_batch_test_values()
+	{
+		using value_t = typename fixed_point_t::value_type;
+		const auto max_value = static_cast<double>(std::numeric_limits<value_t>::max()) / fixed_point_t::scale_value;
+		const auto min_value = static_cast<double>(std::numeric_limits<value_t>::min()) / fixed_point_t::scale_value;
+		constexpr double unit = 1.0 / fixed_point_t::scale_value;
+
+		std::vector<double> values = { 0.0, -0.0, 1.0, -2.5, 0.125, std::numeric_limits<double>::quiet_NaN(),
+			std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), 1e300, max_value, -max_value, max_value * 2,
+			max_value + 0.3 * unit, max_value + 0.7 * unit, min_value - 0.3 * unit, min_value - 0.7 * unit }; // rounded into range or not
+
+		std::uint64_t state = 11;
+		for (int i = 0; i < 5000; ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			const auto fraction = static_cast<double>(state >> 11) / static_cast<double>(1ull << 53);
+			const auto magnitude = (i % 3 == 0) ? fraction * max_value : fraction * 1000; // large values leave the vector range of 64 bit types
+			auto value = (state & 1) ? -magnitude : magnitude;
+
+			if (i % 5 == 0) // halves of the last digit and their neighbours
+			{
+				value = (std::round(value * fixed_point_t::scale_value) + 0.5) / fixed_point_t::scale_value;
+				if (i % 2 == 0)
+					value = std::nextafter(value, 0.0);
+			}
+
+			values.push_back(value);
+		}
+
+		return values;
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Batch conversion", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+
+		const auto values = generate_batch_test_values<fixed_point_type>();
+		const auto initial_value = fixed_point_type::from_raw_value(7);
+
+		// every size of the tail after full vector blocks
+		for (std::size_t size = values.size() - 17; size <= values.size(); ++size)
+		{
+			std::vector<fixed_point_type> converted(size, initial_value);
+			const auto status = convert_batch(span<const double>(values.data(), size), span<fixed_point_type>(converted));
+
+			auto expected_status = fixed_point_status::ok;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const auto expected = try_convert<fixed_point_type>(values[i]);
+				REQUIRE(converted[i] == expected.value_or(initial_value));
+				if (!expected)
+					expected_status = expected.status();
+			}
+
+			REQUIRE(status == expected_status);
+		}
+
+		// whole vector blocks of values rounded into range from beyond the limits,
+		// doubles next to the limits of 64 bit types are too far apart for that
+		if constexpr (sizeof(TestType) < sizeof(std::int64_t))
+		{
+			const auto min_value_beyond_limit = (static_cast<double>(std::numeric_limits<TestType>::min()) - 0.3) / fixed_point_type::scale_value;
+			const std::vector<double> beyond_limits(16, min_value_beyond_limit);
+			std::vector<fixed_point_type> limits(beyond_limits.size());
+			REQUIRE(convert_batch(span<const double>(beyond_limits), span<fixed_point_type>(limits)) == fixed_point_status::ok);
+			REQUIRE(limits == std::vector<fixed_point_type>(limits.size(), fixed_point_type::from_raw_value(std::numeric_limits<TestType>::min())));
+		}
+
+		std::vector<fixed_point_type> numbers(values.size());
+		for (std::size_t i = 0; i < values.size(); ++i)
+			numbers[i] = fixed_point_type::from_raw_value(static_cast<TestType>(static_cast<std::uint64_t>(i) * 0x9e3779b97f4a7c15ull));
+
+		std::vector<double> doubles(numbers.size());
+		REQUIRE(convert_batch(span<const fixed_point_type>(numbers), span<double>(doubles)) == fixed_point_status::ok);
+		for (std::size_t i = 0; i < numbers.size(); ++i)
+			REQUIRE(doubles[i] == static_cast<double>(numbers[i]));
+
+		REQUIRE_THROWS_AS(convert_batch(span<const double>(values.data(), 3), span<fixed_point_type>(numbers)), std::invalid_argument);
+	}
+
+	template <bool subtraction, typename fixed_point_t>
+	void test_add_subtract_batch(const std::vector<fixed_point_t> & a, const std::vector<fixed_point_t> & b)
+	{
+		using value_t = typename fixed_point_t::value_type;
+
+		auto expected_first_overflow = a.size();
+		std::vector<fixed_point_t> expected(a.size());
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			value_t result = 0;
+			const auto overflow = subtraction ?
+				details::subtract_overflow(a[i].raw_value(), b[i].raw_value(), result) :
+				details::add_overflow(a[i].raw_value(), b[i].raw_value(), result);
+			expected[i] = fixed_point_t::from_raw_value(result);
+			if (overflow && expected_first_overflow == a.size())
+				expected_first_overflow = i;
+		}
+
+		const auto batch = [](const std::vector<fixed_point_t> & lhs, const std::vector<fixed_point_t> & rhs, std::vector<fixed_point_t> & out)
+		{
+			return subtraction ?
+				sub(span<const fixed_point_t>(lhs), span<const fixed_point_t>(rhs), span<fixed_point_t>(out)) :
+				add(span<const fixed_point_t>(lhs), span<const fixed_point_t>(rhs), span<fixed_point_t>(out));
+		};
+
+		std::vector<fixed_point_t> out(a.size());
+		REQUIRE(batch(a, b, out) == expected_first_overflow);
+		REQUIRE(out == expected);
+
+		auto in_place = a; // results replace the first operand
+		REQUIRE(batch(in_place, b, in_place) == expected_first_overflow);
+		REQUIRE(in_place == expected);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Batch add and subtract", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+
+		constexpr auto max_value = std::numeric_limits<TestType>::max();
+		constexpr auto min_value = std::numeric_limits<TestType>::min();
+
+		std::vector<fixed_point_type> a(300);
+		std::vector<fixed_point_type> b(a.size());
+
+		std::uint64_t state = 5;
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			a[i] = fixed_point_type::from_raw_value(static_cast<TestType>(static_cast<TestType>(state >> 40) / 4));
+			b[i] = fixed_point_type::from_raw_value(static_cast<TestType>(static_cast<TestType>(state >> 20) / 4));
+		}
+
+		// every size of the tail after full vector and scalar blocks
+		for (std::size_t size = 0; size <= 140; ++size)
+		{
+			const std::vector<fixed_point_type> lhs(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(size));
+			const std::vector<fixed_point_type> rhs(b.begin(), b.begin() + static_cast<std::ptrdiff_t>(size));
+			test_add_subtract_batch<false>(lhs, rhs);
+			test_add_subtract_batch<true>(lhs, rhs);
+		}
+
+		// overflow at every position of the first blocks, then another one later which must not be reported
+		const std::pair<TestType, TestType> overflows[] = { { max_value, 1 }, { min_value, min_value }, { min_value, -1 }, { max_value, min_value }, { -1, max_value } };
+		for (std::size_t position = 0; position < 80; ++position)
+		{
+			for (const auto & overflow : overflows)
+			{
+				auto lhs = a;
+				auto rhs = b;
+				lhs[position] = fixed_point_type::from_raw_value(overflow.first);
+				rhs[position] = fixed_point_type::from_raw_value(overflow.second);
+				lhs[position + 150] = fixed_point_type::from_raw_value(max_value);
+				rhs[position + 150] = fixed_point_type::from_raw_value(max_value);
+				test_add_subtract_batch<false>(lhs, rhs);
+				test_add_subtract_batch<true>(lhs, rhs);
+			}
+		}
+
+		std::vector<fixed_point_type> out(a.size());
+		REQUIRE_THROWS_AS(add(span<const fixed_point_type>(a.data(), 3), span<const fixed_point_type>(b), span<fixed_point_type>(out)), std::invalid_argument);
+		REQUIRE_THROWS_AS(sub(span<const fixed_point_type>(a), span<const fixed_point_type>(b), span<fixed_point_type>(out.data(), 3)), std::invalid_argument);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Batch scale", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+
+		constexpr auto max_value = std::numeric_limits<TestType>::max();
+		constexpr auto min_value = std::numeric_limits<TestType>::min();
+		constexpr auto bits_num = static_cast<unsigned int>(std::numeric_limits<TestType>::digits);
+
+		// magnitudes of every bit length, so that products both fit and overflow
+		std::vector<fixed_point_type> values = { 0, fixed_point_type::from_raw_value(max_value), fixed_point_type::from_raw_value(min_value) };
+		std::uint64_t state = 11;
+		for (std::size_t i = 0; i < 200; ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			values.push_back(fixed_point_type::from_raw_value(static_cast<TestType>(static_cast<TestType>(state >> 32) >> (i % bits_num))));
+		}
+
+		// whole numbers, fractions and factors out of range of narrow types wrapped around to arbitrary ones
+		const std::int64_t factors[] = { 0, 1, -1, 50, -50, 100, -100, 300, -300, 150, -37, 99, 101, max_value, min_value,
+			static_cast<TestType>(max_value / 3), static_cast<TestType>(min_value / 7), static_cast<TestType>(max_value / 100 * 100) };
+
+		const auto initial_value = fixed_point_type::from_raw_value(7);
+		for (const auto raw_factor : factors)
+		{
+			const auto factor = fixed_point_type::from_raw_value(static_cast<TestType>(raw_factor));
+
+			std::vector<fixed_point_type> scaled(values.size(), initial_value);
+			const auto status = scale_batch(span<const fixed_point_type>(values), factor, span<fixed_point_type>(scaled));
+
+			auto expected_status = fixed_point_status::ok;
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				const auto expected = try_mul(values[i], factor);
+				REQUIRE(scaled[i] == expected.value_or(initial_value));
+				if (!expected)
+					expected_status = expected.status();
+			}
+
+			REQUIRE(status == expected_status);
+
+			auto in_place = values;
+			REQUIRE(scale_batch(span<const fixed_point_type>(in_place), factor, span<fixed_point_type>(in_place)) == expected_status);
+			for (std::size_t i = 0; i < values.size(); ++i)
+				REQUIRE(in_place[i] == try_mul(values[i], factor).value_or(values[i]));
+		}
+
+		std::vector<fixed_point_type> out(values.size());
+		REQUIRE_THROWS_AS(scale_batch(span<const fixed_point_type>(values.data(), 3), fixed_point_type(1), span<fixed_point_type>(out)), std::invalid_argument);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Batch divide", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+
+		constexpr auto max_value = std::numeric_limits<TestType>::max();
+		constexpr auto min_value = std::numeric_limits<TestType>::min();
+		constexpr auto bits_num = static_cast<unsigned int>(std::numeric_limits<TestType>::digits);
+
+		// magnitudes of every bit length, so that quotients both fit and overflow
+		std::vector<fixed_point_type> values = { 0, fixed_point_type::from_raw_value(max_value), fixed_point_type::from_raw_value(min_value) };
+		std::uint64_t state = 13;
+		for (std::size_t i = 0; i < 200; ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			values.push_back(fixed_point_type::from_raw_value(static_cast<TestType>(static_cast<TestType>(state >> 32) >> (i % bits_num))));
+		}
+
+		// divisors out of range of narrow types are wrapped around to arbitrary ones
+		const std::int64_t divisors[] = { 1, -1, 2, 3, -7, 50, 100, -100, 150, 333, -1000, max_value, min_value,
+			static_cast<TestType>(max_value / 3), static_cast<TestType>(min_value / 7), static_cast<TestType>(max_value / 100 * 100) };
+
+		const auto initial_value = fixed_point_type::from_raw_value(7);
+		for (const auto raw_divisor : divisors)
+		{
+			const auto divisor_value = fixed_point_type::from_raw_value(static_cast<TestType>(raw_divisor));
+			const fixed_point_divisor<fixed_point_type> divisor(divisor_value);
+			REQUIRE(divisor.value() == divisor_value);
+
+			std::vector<fixed_point_type> divided(values.size(), initial_value);
+			const auto status = divide_batch(span<const fixed_point_type>(values), divisor, span<fixed_point_type>(divided));
+
+			auto expected_status = fixed_point_status::ok;
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				const auto expected = try_div(values[i], divisor_value);
+				const auto quotient = try_div(values[i], divisor);
+				REQUIRE(quotient.status() == expected.status());
+				REQUIRE(quotient.value_or(initial_value) == expected.value_or(initial_value));
+				REQUIRE(divided[i] == expected.value_or(initial_value));
+				if (!expected)
+					expected_status = expected.status();
+			}
+
+			REQUIRE(status == expected_status);
+
+			auto in_place = values;
+			REQUIRE(divide_batch(span<const fixed_point_type>(in_place), divisor, span<fixed_point_type>(in_place)) == expected_status);
+			for (std::size_t i = 0; i < values.size(); ++i)
+				REQUIRE(in_place[i] == try_div(values[i], divisor_value).value_or(values[i]));
+		}
+
+		REQUIRE_THROWS_AS(fixed_point_divisor<fixed_point_type>(fixed_point_type(0)), std::invalid_argument);
+
+		const fixed_point_divisor<fixed_point_type> divisor(fixed_point_type(1));
+		std::vector<fixed_point_type> out(values.size());
+		REQUIRE_THROWS_AS(divide_batch(span<const fixed_point_type>(values.data(), 3), divisor, span<fixed_point_type>(out)), std::invalid_argument);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Sum and dot product", "", template_test_types)
+	{
+		using fixed_point_type = fixed_point_number<TestType, 2>;
+		using raw_span = span<const fixed_point_type>;
+
+		constexpr auto max_value = std::numeric_limits<TestType>::max();
+		constexpr auto min_value = std::numeric_limits<TestType>::min();
+		constexpr auto bits_num = static_cast<unsigned int>(std::numeric_limits<TestType>::digits);
+
+		const auto from_raw = [](std::int64_t value) { return fixed_point_type::from_raw_value(static_cast<TestType>(value)); };
+
+		// values small enough for a naive sum of try_mul results to stay in range of the wide type
+		std::vector<fixed_point_type> a;
+		std::vector<fixed_point_type> b;
+		std::uint64_t state = 17;
+		for (std::size_t i = 0; i < 300; ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			a.push_back(from_raw(static_cast<TestType>(state >> 32) >> (bits_num / 2 + i % (bits_num / 2))));
+			b.push_back(from_raw(static_cast<TestType>(state >> 16) >> (bits_num / 2 + i % (bits_num / 2))));
+		}
+
+		for (std::size_t size = 0; size <= a.size(); size += 13)
+		{
+			details::int128_t expected_sum = 0;
+			details::int128_t expected_dot = 0;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				expected_sum += details::int128_t(a[i].raw_value());
+				expected_dot += details::int128_t(a[i].raw_value()) * details::int128_t(b[i].raw_value());
+			}
+			expected_dot = default_round_policy::round_div(expected_dot, details::int128_t(fixed_point_type::scale_value));
+
+			const auto check = [](const checked_result<fixed_point_type> & result, const details::int128_t & expected)
+			{
+				const auto in_range = !details::is_out_of_range<TestType>(expected);
+				REQUIRE(result.has_value() == in_range);
+				if (in_range)
+					REQUIRE(result.value().raw_value() == static_cast<TestType>(expected));
+				else
+					REQUIRE(result.status() == fixed_point_status::out_of_range);
+			};
+
+			check(sum(raw_span(a.data(), size)), expected_sum);
+			check(dot(raw_span(a.data(), size), raw_span(b.data(), size)), expected_dot);
+		}
+
+		// intermediate sums out of range do not matter, the final one does
+		const std::vector<fixed_point_type> back_in_range = { from_raw(max_value), from_raw(max_value), from_raw(-max_value), from_raw(min_value), from_raw(min_value), from_raw(max_value) };
+		REQUIRE(sum(raw_span(back_in_range)).value().raw_value() == -2); // 2 * (max_value + min_value)
+
+		const std::vector<fixed_point_type> out_of_range = { from_raw(max_value), from_raw(1) };
+		REQUIRE(sum(raw_span(out_of_range)).status() == fixed_point_status::out_of_range);
+
+		// products of extremes, whose intermediate sums do not fit into the double word type for 64 bit storage
+		const std::vector<fixed_point_type> extremes = { from_raw(max_value), from_raw(max_value), from_raw(max_value), from_raw(max_value), from_raw(min_value) };
+		const std::vector<fixed_point_type> signs = { from_raw(max_value), from_raw(max_value), from_raw(-max_value), from_raw(-max_value), from_raw(0) };
+		REQUIRE(dot(raw_span(extremes), raw_span(signs)).value() == 0);
+		REQUIRE(dot(raw_span(extremes.data(), 3), raw_span(signs.data(), 3)).status() == fixed_point_status::out_of_range);
+
+		const std::vector<fixed_point_type> units = { from_raw(min_value), from_raw(1), from_raw(max_value) };
+		const std::vector<fixed_point_type> ones = { fixed_point_type(1), fixed_point_type(1), fixed_point_type(1) };
+		REQUIRE(dot(raw_span(units), raw_span(ones)).value() == sum(raw_span(units)).value());
+
+		REQUIRE_THROWS_AS(dot(raw_span(a.data(), 3), raw_span(b)), std::invalid_argument);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Counting observer policy", "", template_test_types)
+	{
+		using observer_type = counting_observer_policy<>;
+		using fixed_point_type = fixed_point_number<TestType, 1, default_round_policy, throw_overflow_policy, observer_type>;
+
+		static_assert(sizeof(fixed_point_type) == sizeof(TestType), "Observer policy must not add state to numbers.");
+
+		observer_type::reset();
+		const auto & counters = observer_type::counters<fixed_point_type>();
+
+		const fixed_point_type a = 3;
+		const fixed_point_type b = 2;
+		auto c = a + b;
+		c = c - b;
+		c = -c;
+		++c;
+		REQUIRE(a * b == 6);
+		REQUIRE(a / 7 == fixed_point_type(4) / 10);
+
+		REQUIRE(counters[fixed_point_operation::add] == 2);
+		REQUIRE(counters[fixed_point_operation::subtract] == 1);
+		REQUIRE(counters[fixed_point_operation::negate] == 1);
+		REQUIRE(counters[fixed_point_operation::multiply] == 1);
+		REQUIRE(counters[fixed_point_operation::divide] == 2);
+		REQUIRE(counters.round_divisions == 3); // only 3 / 7 of 3 * 2, 3 / 7 and 4 / 10 is inexact
+		REQUIRE(counters.inexact_round_divisions == 1);
+		REQUIRE(counters.near_overflow_results == 0);
+
+		const auto half_max = fixed_point_type::from_raw_value(std::numeric_limits<TestType>::max() / 2);
+		REQUIRE(half_max + fixed_point_type() == half_max);
+		REQUIRE(counters.near_overflow_results == 0);
+		REQUIRE(half_max + fixed_point_type::from_raw_value(1) > half_max);
+		REQUIRE(counters.near_overflow_results == 1);
+
+		// a type differing only in the overflow policy is counted and dumped separately
+		using saturating_type = fixed_point_number<TestType, 1, default_round_policy, saturate_overflow_policy, observer_type>;
+		REQUIRE(saturating_type(1) + saturating_type(1) == 2);
+		REQUIRE(counters[fixed_point_operation::add] == 4);
+
+		std::ostringstream dump;
+		observer_type::dump(dump);
+		const auto dump_label = [text = dump.str()](const std::string & counts) // other types are reset to zero counts
+		{
+			const auto counts_pos = text.find(": " + counts + "\n");
+			REQUIRE(counts_pos != std::string::npos);
+			const auto line_begin = text.rfind('\n', counts_pos) + 1; // zero for the first line
+			return text.substr(line_begin, counts_pos - line_begin);
+		};
+
+		const auto throwing_label = dump_label("add 4 subtract 1 multiply 1 divide 2 negate 1 near_overflow 1 round_div 3 inexact_round_div 1");
+		const auto saturating_label = dump_label("add 1 subtract 0 multiply 0 divide 0 negate 0 near_overflow 0 round_div 0 inexact_round_div 0");
+		REQUIRE(throwing_label.find("throw_overflow_policy") != std::string::npos);
+		REQUIRE(saturating_label.find("saturate_overflow_policy") != std::string::npos);
+
+		observer_type::reset();
+		REQUIRE(counters[fixed_point_operation::add] == 0);
+		REQUIRE(counters.round_divisions == 0);
+	}
+
+	TEMPLATE_LIST_TEST_CASE("Counting observer policy at storage type boundaries", "", template_test_types)
+	{
+		using observer_type = counting_observer_policy<>;
+		using fixed_point_type = fixed_point_number<TestType, 1, default_round_policy, throw_overflow_policy, observer_type>;
+
+		observer_type::reset();
+		const auto & counters = observer_type::counters<fixed_point_type>();
+
+		constexpr auto max_value = std::numeric_limits<TestType>::max();
+		constexpr auto min_value = std::numeric_limits<TestType>::min();
+
+		// the last decimal digit of both boundaries is rounded away from zero, the rounded quotient times the scale is out of range
+		REQUIRE(static_cast<TestType>(fixed_point_type::from_raw_value(max_value)) == max_value / 10 + 1);
+		REQUIRE(static_cast<TestType>(fixed_point_type::from_raw_value(min_value)) == min_value / 10 - 1);
+
+		REQUIRE(counters.round_divisions == 2);
+		REQUIRE(counters.inexact_round_divisions == 2);
 	}
 }
\ No newline at end of file